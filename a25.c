@@ -22,8 +22,16 @@
 #define DONT_INCLUDE_MAIN
 #define NO_FREQ_SETUP
 
+// a25 builds its own sets, and always looks up words via the hash table
+#undef WORD_INDEX
+
 #include "utilities.h"
 
+// a25 pairs up two-word and three-word solutions, so it only does 5x5
+#if (WORD_LEN != 5) || (NUM_WORDS != 5)
+#error "a25 only supports 5 words of 5 letters"
+#endif
+
 #if 0
 uint32_t num_combos = 0;
 int8_t	combos[14950][4];
@@ -51,19 +59,19 @@ combo(int n, int r, int d)
 void
 create_sets()
 {
-	uint32_t *kp = keys, mask, *ks, key;
+	uint32_t *kp = ctx->keys, mask, *ks, key;
 
-	qsort(frq, 26, sizeof(*frq), by_frequency_hi);
+	qsort(ctx->frq, 26, sizeof(*ctx->frq), by_frequency_hi);
 
-	mask = frq[0].m;
-	frq[0].sets[0].s = kp;
+	mask = ctx->frq[0].m;
+	ctx->frq[0].sets[0].s = kp;
 	for (ks = kp; (key = *ks); ks++) {
 		if (key & mask) {
 			*ks = *kp;
 			*kp++ = key;
 		}
 	}
-	frq[0].sets[0].l = kp - frq[0].sets[0].s;
+	ctx->frq[0].sets[0].l = kp - ctx->frq[0].sets[0].s;
 
 	// 0-terminate this frequency key set
 	*ks++ = *kp;
@@ -72,8 +80,8 @@ create_sets()
 	// Ensure key set is 0 terminated for next loop
 	*ks = 0;
 
-	frq[1].sets[0].s = kp;
-	frq[1].sets[0].l = ks - kp;
+	ctx->frq[1].sets[0].s = kp;
+	ctx->frq[1].sets[0].l = ks - kp;
 } // create_sets
 
 
@@ -81,7 +89,7 @@ create_sets()
 static void
 add_solution(uint32_t key0, uint32_t key1, uint32_t key2, uint32_t key3, uint32_t key4)
 {
-	char *so = solutions + (atomic_fetch_add(&num_sol, 1) << 5);
+	char *so = ctx->solutions + (atomic_fetch_add(&ctx->num_sol, 1) << 5);
 
 	*(uint64_t *)so = *(uint64_t *)hash_lookup(key0);
 	so[5] = '\t'; so += 6;
@@ -100,27 +108,143 @@ add_solution(uint32_t key0, uint32_t key1, uint32_t key2, uint32_t key3, uint32_
 } // add_solution
 
 
-#define FOUR_READY  ((uint32_t)0xEAD1EAD1)
-
+// ********************* FOUR SET PIPELINE ********************
+
+// Each solver gathers the 4-word partials that it finds into a batch, and
+// pushes full batches onto a bounded lock-free ring, so that whichever
+// solver pops one scans the a set once for the whole batch.  The ring is a
+// Vyukov MPMC queue, where each cell's sequence number says whether it's
+// free to push to or ready to pop from.  When it's full, the solver just
+// applies its own batch there and then, and when the solvers are done with
+// their partials they drain it.  So nothing ever waits on anything else,
+// and the memory is fixed, however many partials there are
+#define FOUR_BATCH	64	// Four-sets per batch
+#define FOUR_RING	64	// Batches in the ring.  Must be a power of 2
+
+struct four_batch {
+	uint32_t	n;
+	uint32_t	mask[FOUR_BATCH];
+	uint32_t	keys[FOUR_BATCH][4];
+};
+
+struct four_cell {
+	atomic_size_t	seq;
+	struct four_batch b;
+} __attribute__ ((aligned(64)));
+
+static struct four_cell	ring[FOUR_RING];
+static atomic_size_t	ring_push	__attribute__ ((aligned(64))) = 0;
+static atomic_size_t	ring_pop	__attribute__ ((aligned(64))) = 0;
 atomic_int num_four = 0;
-uint32_t   fourset[6291456] = {0};
+
+static void
+ring_init()
+{
+	for (size_t i = 0; i < FOUR_RING; i++)
+		atomic_store_explicit(&ring[i].seq, i, memory_order_relaxed);
+} // ring_init
+
+// Finds the a set words that complete each of the batch's four-sets.  Each
+// a set key is tested against every four-set before moving on to the next
+static void
+apply_batch(struct four_batch *b)
+{
+	uint32_t *z = ctx->frq[0].sets[0].s, key;
+
+	while ((key = *z++)) {
+		uint32_t hit = 0;
+
+		// Hits are rare, so this is kept simple enough to vectorise, and
+		// only when there is one do we go back to find which
+		for (uint32_t j = 0; j < FOUR_BATCH; j++)
+			hit |= !(key & b->mask[j]);
+
+		if (hit)
+			for (uint32_t j = 0; j < FOUR_BATCH; j++)
+				if (!(key & b->mask[j]))
+					add_solution(key, b->keys[j][0], b->keys[j][1], b->keys[j][2], b->keys[j][3]);
+	}
+} // apply_batch
+
+// Pushes the batch onto the ring.  Returns 0 if the ring is full
+static int
+push_batch(struct four_batch *b)
+{
+	size_t pos = atomic_load_explicit(&ring_push, memory_order_relaxed);
+	struct four_cell *c;
+
+	for (;;) {
+		c = ring + (pos & (FOUR_RING - 1));
+
+		intptr_t dif = (intptr_t)atomic_load_explicit(&c->seq, memory_order_acquire) - (intptr_t)pos;
+
+		if (dif < 0)
+			return 0;
+		if (dif > 0)
+			pos = atomic_load_explicit(&ring_push, memory_order_relaxed);
+		else if (atomic_compare_exchange_weak_explicit(&ring_push, &pos, pos + 1,
+							       memory_order_relaxed, memory_order_relaxed))
+			break;
+	}
+
+	c->b.n = b->n;
+	memcpy(c->b.mask, b->mask, b->n * sizeof(b->mask[0]));
+	memcpy(c->b.keys, b->keys, b->n * sizeof(b->keys[0]));
+	atomic_store_explicit(&c->seq, pos + 1, memory_order_release);
+	return 1;
+} // push_batch
+
+// Pops a batch off the ring and applies it where it sits.  Returns 0 if
+// the ring is empty
+static int
+pop_batch()
+{
+	size_t pos = atomic_load_explicit(&ring_pop, memory_order_relaxed);
+	struct four_cell *c;
+
+	for (;;) {
+		c = ring + (pos & (FOUR_RING - 1));
+
+		intptr_t dif = (intptr_t)atomic_load_explicit(&c->seq, memory_order_acquire) - (intptr_t)(pos + 1);
+
+		if (dif < 0)
+			return 0;
+		if (dif > 0)
+			pos = atomic_load_explicit(&ring_pop, memory_order_relaxed);
+		else if (atomic_compare_exchange_weak_explicit(&ring_pop, &pos, pos + 1,
+							       memory_order_relaxed, memory_order_relaxed))
+			break;
+	}
+
+	apply_batch(&c->b);
+	atomic_store_explicit(&c->seq, pos + FOUR_RING, memory_order_release);
+	return 1;
+} // pop_batch
 
 static inline void
-add_fourset(uint32_t key0, uint32_t key1, uint32_t key2, uint32_t key3)
+add_fourset(struct four_batch *b, uint32_t key0, uint32_t key1, uint32_t key2, uint32_t key3)
 {
-	uint32_t mask = (key0 | key1 | key2 | key3);
-	uint32_t *f = fourset + (atomic_fetch_add(&num_four, 1) * 6);
+	uint32_t *k = b->keys[b->n];
 
-	*f++ = mask; *f++ = key0; *f++ = key1; *f++ = key2; *f++ = key3;
-	*f = FOUR_READY;
-} // add_solution
+	b->mask[b->n++] = key0 | key1 | key2 | key3;
+	k[0] = key0; k[1] = key1; k[2] = key2; k[3] = key3;
+
+	if (b->n < FOUR_BATCH)
+		return;
+
+	// With the ring full, it's quicker to do it ourselves than to wait
+	if (!push_batch(b))
+		apply_batch(b);
+	atomic_fetch_add(&num_four, b->n);
+	b->n = 0;
+} // add_fourset
 
 
 // s0-s3 = starts of the scanbuf
 // s0, s1 remain fixed
 // s2, s3 can change depending upon what is found
 static inline void
-gen_four_set(uint32_t *s0, uint32_t *s1, uint32_t key0)
+gen_four_set(struct four_batch *b, uint32_t *s0, uint32_t *s1, uint32_t key0)
 {
 	uint32_t *k1 = s0, scan, key1;
 
@@ -147,64 +271,28 @@ gen_four_set(uint32_t *s0, uint32_t *s1, uint32_t key0)
 					if (!(key3 & scan))
 						add_solution(key0, key1, key2, key3, scan);
 
-				add_fourset(key0, key1, key2, key3);
+				add_fourset(b, key0, key1, key2, key3);
 			}
 		}
 	}
 } // gen_four_set
 
 // Top level driver
-atomic_int	four_pos = 0;
-atomic_size_t	spins = 0;
 atomic_int	driver_pos = 0;
-atomic_int	solvers_synced = 0;
-
-// A gormless attempt at a lockless way to process fourset
-static inline uint32_t
-apply_four()
-{
-	uint32_t *zp = frq[0].sets[0].s, key, *fp = fourset, pos, *f, *z;
-
-	do {
-		while (four_pos >= num_four) {
-			if (solvers_synced >= nthreads)
-				return four_pos;
-			atomic_fetch_add(&spins, 1);
-		}
-
-		pos = atomic_fetch_add(&four_pos, 1);
-		f = fp + (pos * 6);
-		z = zp;
-
-		// We over-shot.  Check if all threads are done
-		while (pos >= num_four) {
-			if (solvers_synced >= nthreads)
-				return pos;
-			atomic_fetch_add(&spins, 1);
-		}
-
-		// Spin-wait until our data is ready
-		while (*(f + 5) != FOUR_READY)
-			atomic_fetch_add(&spins, 1);
-
-		while ((key = *z++))
-			if (!(key & *f))
-				add_solution(key, f[1], f[2], f[3], f[4]);
-	} while (1);
-} // apply_four
-
 
 // driver is written to allow for either threaded or non-threaded use
 void
 solve_work()
 {
 	uint32_t scanbuf[4096];
-	uint32_t *dp = frq[1].sets[0].s, *sp = scanbuf;
+	uint32_t *dp = ctx->frq[1].sets[0].s, *sp = scanbuf;
+	struct four_batch b[1];
 
+	b->n = 0;
 	for (;;) {
 		int pos = atomic_fetch_add(&driver_pos, 1);
 
-		if (pos >= frq[1].sets[0].l)
+		if (pos >= ctx->frq[1].sets[0].l)
 			break;
 
 		uint32_t *d = dp + pos;
@@ -218,35 +306,31 @@ solve_work()
 				*s++ = scan;
 		*s++ = 0;
 		if (*sp)
-			gen_four_set(sp, s, key);
+			gen_four_set(b, sp, s, key);
 	}
 
-	atomic_fetch_add(&solvers_synced, 1);
-
-	apply_four();
+	// Finish off our own partial batch, and then help to drain the ring.
+	// Anything pushed after we find it empty gets drained by its pusher
+	for (uint32_t j = b->n; j < FOUR_BATCH; j++)
+		b->mask[j] = (uint32_t)(~0);
+	apply_batch(b);
+	atomic_fetch_add(&num_four, b->n);
+	while (pop_batch());
 
-	atomic_fetch_add(&solvers_done, 1);
+	handoff_add(&ctx->solvers_done, 1);
 } // solve_work
 
 
 void
 solve()
 {
-	// Instruct waiting worker threads to start solving
-	start_solvers();
-
-	// We have to solve ourselves if we're the only thread
-	if (nthreads < 2)
-		solve_work();
-	else
-		atomic_fetch_add(&solvers_synced, 1);
+	ring_init();
 
-	// Process fourset while waiting
-	apply_four();
-	atomic_fetch_add(&solvers_done, 1);
+	// Instruct waiting worker threads to start solving, and join in
+	start_solvers();
+	solve_work();
 
-	while(solvers_done < nthreads)
-		usleep(1);
+	wait_for(&ctx->solvers_done, ctx->nthreads);
 } // solve
 
 int
@@ -259,7 +343,8 @@ main(int argc, char *argv[])
 	// Copy in a default file-name
 	strcpy(file, "words_alpha.txt");
 
-	nthreads = get_nthreads();
+	settings_init();
+	ctx->nthreads = get_nthreads();
 
 	if (argc > 1) {
 		for (int i = 1; i < argc; i++) {
@@ -279,12 +364,12 @@ main(int argc, char *argv[])
 
 			if (!strncmp(argv[i], "-t", 2)) {
 				if ((i + 1) < argc) {
-					nthreads = atoi(argv[i+1]);
+					ctx->nthreads = atoi(argv[i+1]);
 					i++;
-					if (nthreads < 0)
-						nthreads = 1;
-					if (nthreads > MAX_THREADS)
-						nthreads = MAX_THREADS;
+					if (ctx->nthreads < 0)
+						ctx->nthreads = 1;
+					if (ctx->nthreads > MAX_THREADS)
+						ctx->nthreads = MAX_THREADS;
 					continue;
 				}
 			}
@@ -294,16 +379,17 @@ main(int argc, char *argv[])
 		}
 	}
 
-	if (nthreads <= 0)
-		nthreads = 1;
-	if (nthreads > MAX_THREADS)
-		nthreads = MAX_THREADS;
-        for (int i = 1; i < nthreads; i++)
-                pthread_create(tid, NULL, work_pool, workers + i);
+	if (ctx->nthreads <= 0)
+		ctx->nthreads = 1;
+	if (ctx->nthreads > MAX_THREADS)
+		ctx->nthreads = MAX_THREADS;
+        for (int i = 1; i < ctx->nthreads; i++)
+                pthread_create(tid, NULL, work_pool, ctx->workers + i);
 
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t1);
 
-	read_words(file);
+	if (read_words(file) < 0)
+		exit(EXIT_FAILURE);
 
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t2);
 
@@ -322,14 +408,14 @@ main(int argc, char *argv[])
 	if (!write_metrics)
 		exit(0);
 
-	printf("Num Unique Words    = %8d\n", nkeys);
-	printf("Hash Collisions     = %8u\n", hash_collisions);
-	printf("Number of threads   = %8d\n", nthreads);
+	printf("Num Unique Words    = %8d\n", ctx->nkeys);
+	printf("Hash Collisions     = %8u\n", ctx->hash_collisions);
+	printf("Number of threads   = %8d\n", ctx->nthreads);
 	printf("Number of Four Sets = %8d\n", num_four);
-	printf("Zero Set Size       = %8d\n", frq[0].sets[0].l);
-	printf("Driver Set Size     = %8d\n", frq[1].sets[0].l);
+	printf("Zero Set Size       = %8d\n", ctx->frq[0].sets[0].l);
+	printf("Driver Set Size     = %8d\n", ctx->frq[1].sets[0].l);
 
-	printf("\nNUM SOLUTIONS = %d\n", num_sol);
+	printf("\nNUM SOLUTIONS = %d\n", ctx->num_sol);
 
 	printf("\nTIMES TAKEN :\n");
 	print_time_taken("Total", t1, t5);
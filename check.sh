@@ -31,3 +31,91 @@ if [ -e "solutions.txt" ]; then
 	sort < solutions.txt | diff - expected_solutions.txt
 fi
 
+
+echo
+echo
+echo "Checking d25 output correctness"
+rm -f solutions.txt
+./d25 -f words_alpha.txt
+sort < solutions.txt | diff - expected_solutions.txt
+
+for engine in bfs bitmap mitm; do
+	echo
+	echo
+	echo "Checking v25 -e $engine output correctness"
+	rm -f solutions.txt
+	./v25 -e $engine -f words_alpha.txt
+	sort < solutions.txt | diff - expected_solutions.txt
+done
+
+
+echo
+echo
+echo "Checking constrained solves"
+echo "Each solver should find 467 solutions without the letter q"
+for solver in s25 v25 525 d25; do
+	./$solver -v -x q -f words_alpha.txt 2> /dev/null | grep "NUM SOLUTIONS" | sed "s/^/$solver /"
+done
+
+echo
+echo
+echo "Checking a tier range of more than 1024 keys"
+echo "Each solver should find 2018016 solutions, both times"
+# Every word of 5 of the 16 letters k to z, after abcde and fghij which each
+# solution must then have.  The 3 other words of a solution skip one of the
+# 16 letters, so there's 16 * 15! / (5! * 5! * 5! * 3!) = 2018016 solutions
+awk 'BEGIN {
+	l = "klmnopqrstuvwxyz"
+	print "abcde"
+	print "fghij"
+	for (a = 1; a <= 12; a++)
+	for (b = a + 1; b <= 13; b++)
+	for (c = b + 1; c <= 14; c++)
+	for (d = c + 1; d <= 15; d++)
+	for (e = d + 1; e <= 16; e++)
+		print substr(l, a, 1) substr(l, b, 1) substr(l, c, 1) substr(l, d, 1) substr(l, e, 1)
+}' > large_tier.txt
+for solver in s25 v25 525 d25; do
+	./$solver -v -f large_tier.txt 2> /dev/null | grep "NUM SOLUTIONS" | sed "s/^/$solver /"
+	./$solver -v -d 2 -t 1 -f large_tier.txt 2> /dev/null | grep "NUM SOLUTIONS" | sed "s/^/$solver /"
+done
+rm -f large_tier.txt solutions.txt
+
+
+echo
+echo
+echo "Checking that srv25 serves two clients at once"
+echo "B should get ok 467 while A has only sent part of its request, then A ok 538"
+if command -v python3 > /dev/null; then
+	./srv25 -f words_alpha.txt -S srv25_check.sock &
+	srv=$!
+	for i in 1 2 3 4 5 6 7 8 9 10; do
+		[ -S srv25_check.sock ] && break
+		sleep 1
+	done
+	timeout 30 python3 - srv25_check.sock <<'CLIENT'
+import socket, sys
+
+def connect():
+	s = socket.socket(socket.AF_UNIX)
+	s.connect(sys.argv[1])
+	return s.makefile('rwb')
+
+def solve(name, f, rest):
+	f.write(rest)
+	f.flush()
+	hdr = f.readline().decode().strip()
+	for i in range(int(hdr.split()[1])):
+		f.readline()
+	print(name, hdr)
+
+a = connect()
+a.write(b'sol')
+a.flush()
+solve('B', connect(), b'solve -x q\n')
+solve('A', a, b've\n')
+CLIENT
+	kill $srv
+else
+	echo "No python3 to run the clients with"
+fi
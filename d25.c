@@ -0,0 +1,74 @@
+// A solution to the Parker 5x5 Unique Word Problem
+//
+// Author: Stew Forster (stew675@gmail.com)	Date: Aug 2022
+//
+// d25 carries the s25, v25 and 525 solver kernels in a single executable,
+// and uses cpuid at start-up to run the fastest one the CPU supports.  It
+// is built for a baseline x86-64 ISA, so one binary runs on any host
+//
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <immintrin.h>
+
+// NUM_POISON must be defined before include utilities.h
+// The AVX kernels need 16, which the scalar kernel doesn't mind
+#define	NUM_POISON	16
+#define RUNTIME_DISPATCH
+
+#include "utilities.h"
+
+#define KERNEL_ISA	KERNEL_SCALAR
+#include "kernels.h"
+#undef KERNEL_ISA
+
+#define KERNEL_ISA	KERNEL_AVX2
+#include "kernels.h"
+#undef KERNEL_ISA
+
+#define KERNEL_ISA	KERNEL_AVX512
+#include "kernels.h"
+#undef KERNEL_ISA
+
+static void (*solve_work_isa)() = solve_work_scalar;
+
+static void
+bind_kernels(int isa)
+{
+	if (isa == KERNEL_AVX512)
+		solve_work_isa = solve_work_avx512;
+	else if (isa == KERNEL_AVX2)
+		solve_work_isa = solve_work_avx2;
+	else
+		solve_work_isa = solve_work_scalar;
+} // bind_kernels
+
+static void
+solve_work()
+{
+	solve_work_isa();
+} // solve_work
+
+void
+solve()
+{
+	// Instruct any waiting worker-threads to start solving
+	start_solvers();
+
+	// The main thread also participates in finding solutions
+	solve_work();
+
+	// Wait for all solver threads to finish up
+	wait_for(&ctx->solvers_done, ctx->nthreads);
+} // solve
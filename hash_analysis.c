@@ -1,10314 +0,0 @@
-#include <stdio.h>
-#include <time.h>
-#include <stdint.h>
-#include <string.h>
-#include <stdlib.h>
-#include <assert.h>
-
-uint32_t keys[] = {
-	61,
-	91,
-	91,
-	91,
-	93,
-	93,
-	121,
-	151,
-	151,
-	157,
-	181,
-	279,
-	283,
-	285,
-	286,
-	301,
-	309,
-	313,
-	331,
-	339,
-	339,
-	346,
-	376,
-	391,
-	395,
-	412,
-	436,
-	436,
-	451,
-	457,
-	665,
-	794,
-	850,
-	899,
-	905,
-	905,
-	1051,
-	1053,
-	1081,
-	1171,
-	1173,
-	1173,
-	1173,
-	1177,
-	1299,
-	1299,
-	1306,
-	1336,
-	1413,
-	1417,
-	1428,
-	1432,
-	2071,
-	2071,
-	2075,
-	2075,
-	2075,
-	2077,
-	2077,
-	2077,
-	2077,
-	2099,
-	2101,
-	2101,
-	2131,
-	2131,
-	2131,
-	2131,
-	2131,
-	2131,
-	2133,
-	2137,
-	2137,
-	2195,
-	2195,
-	2197,
-	2197,
-	2197,
-	2198,
-	2201,
-	2201,
-	2228,
-	2317,
-	2317,
-	2323,
-	2323,
-	2325,
-	2325,
-	2325,
-	2325,
-	2326,
-	2329,
-	2329,
-	2329,
-	2329,
-	2330,
-	2330,
-	2332,
-	2341,
-	2353,
-	2353,
-	2356,
-	2360,
-	2360,
-	2360,
-	2360,
-	2360,
-	2373,
-	2377,
-	2385,
-	2385,
-	2385,
-	2386,
-	2386,
-	2392,
-	2392,
-	2435,
-	2437,
-	2438,
-	2441,
-	2441,
-	2444,
-	2452,
-	2452,
-	2456,
-	2456,
-	2456,
-	2456,
-	2468,
-	2497,
-	2512,
-	2579,
-	2616,
-	2834,
-	3079,
-	3091,
-	3091,
-	3091,
-	3093,
-	3093,
-	3094,
-	3097,
-	3109,
-	3121,
-	3121,
-	3124,
-	3141,
-	3205,
-	3217,
-	3217,
-	3331,
-	3331,
-	3333,
-	3333,
-	3334,
-	3337,
-	3345,
-	3345,
-	3345,
-	3348,
-	3352,
-	3361,
-	3364,
-	3393,
-	3393,
-	3396,
-	3408,
-	3408,
-	3408,
-	3457,
-	3457,
-	3472,
-	4123,
-	4125,
-	4153,
-	4153,
-	4179,
-	4185,
-	4185,
-	4245,
-	4249,
-	4249,
-	4363,
-	4371,
-	4371,
-	4373,
-	4377,
-	4377,
-	4377,
-	4377,
-	4378,
-	4378,
-	4380,
-	4389,
-	4404,
-	4419,
-	4421,
-	4421,
-	4433,
-	4440,
-	4483,
-	4483,
-	4483,
-	4485,
-	4485,
-	4485,
-	4486,
-	4489,
-	4500,
-	4500,
-	4500,
-	4545,
-	4627,
-	4881,
-	4881,
-	5385,
-	5393,
-	5400,
-	5505,
-	5505,
-	6151,
-	6163,
-	6163,
-	6163,
-	6163,
-	6163,
-	6165,
-	6165,
-	6165,
-	6165,
-	6169,
-	6169,
-	6169,
-	6179,
-	6193,
-	6193,
-	6225,
-	6256,
-	6289,
-	6289,
-	6289,
-	6292,
-	6403,
-	6405,
-	6405,
-	6405,
-	6406,
-	6409,
-	6417,
-	6417,
-	6417,
-	6417,
-	6420,
-	6420,
-	6424,
-	6424,
-	6480,
-	6480,
-	6529,
-	6529,
-	6532,
-	7185,
-	7185,
-	7425,
-	8219,
-	8219,
-	8219,
-	8219,
-	8221,
-	8221,
-	8221,
-	8221,
-	8243,
-	8249,
-	8275,
-	8275,
-	8275,
-	8281,
-	8305,
-	8331,
-	8341,
-	8341,
-	8341,
-	8341,
-	8341,
-	8342,
-	8345,
-	8387,
-	8389,
-	8389,
-	8401,
-	8404,
-	8455,
-	8455,
-	8459,
-	8461,
-	8461,
-	8461,
-	8469,
-	8469,
-	8469,
-	8469,
-	8470,
-	8473,
-	8473,
-	8473,
-	8474,
-	8485,
-	8504,
-	8504,
-	8504,
-	8515,
-	8515,
-	8517,
-	8529,
-	8529,
-	8530,
-	8530,
-	8530,
-	8532,
-	8536,
-	8536,
-	8536,
-	8536,
-	8536,
-	8545,
-	8560,
-	8581,
-	8581,
-	8581,
-	8585,
-	8585,
-	8593,
-	8596,
-	8596,
-	8596,
-	8609,
-	8612,
-	8641,
-	8641,
-	8644,
-	8656,
-	8656,
-	8723,
-	8984,
-	9235,
-	9241,
-	9241,
-	9241,
-	9241,
-	9265,
-	9349,
-	9361,
-	9364,
-	9481,
-	9489,
-	9496,
-	9496,
-	9520,
-	9537,
-	9537,
-	9552,
-	9601,
-	9604,
-	9604,
-	9985,
-	10247,
-	10251,
-	10259,
-	10259,
-	10261,
-	10261,
-	10261,
-	10261,
-	10261,
-	10265,
-	10265,
-	10265,
-	10265,
-	10265,
-	10265,
-	10266,
-	10289,
-	10309,
-	10313,
-	10321,
-	10321,
-	10321,
-	10321,
-	10321,
-	10321,
-	10321,
-	10321,
-	10337,
-	10373,
-	10388,
-	10499,
-	10499,
-	10499,
-	10501,
-	10501,
-	10501,
-	10505,
-	10505,
-	10505,
-	10505,
-	10506,
-	10513,
-	10513,
-	10513,
-	10513,
-	10513,
-	10513,
-	10513,
-	10513,
-	10516,
-	10516,
-	10516,
-	10520,
-	10520,
-	10529,
-	10529,
-	10529,
-	10544,
-	10544,
-	10544,
-	10561,
-	10561,
-	10561,
-	10561,
-	10561,
-	10561,
-	10564,
-	10576,
-	10576,
-	10576,
-	10576,
-	10592,
-	10625,
-	10625,
-	10628,
-	11009,
-	11024,
-	11267,
-	11269,
-	11281,
-	11282,
-	11297,
-	11521,
-	11521,
-	11521,
-	11522,
-	11524,
-	11536,
-	11536,
-	11584,
-	11584,
-	12307,
-	12307,
-	12313,
-	12313,
-	12313,
-	12313,
-	12313,
-	12313,
-	12337,
-	12369,
-	12369,
-	12433,
-	12433,
-	12547,
-	12549,
-	12549,
-	12553,
-	12553,
-	12553,
-	12553,
-	12561,
-	12561,
-	12561,
-	12561,
-	12561,
-	12561,
-	12561,
-	12562,
-	12564,
-	12564,
-	12568,
-	12568,
-	12568,
-	12609,
-	12609,
-	12624,
-	12624,
-	12673,
-	12688,
-	12688,
-	14353,
-	14353,
-	14593,
-	14593,
-	14593,
-	14608,
-	16411,
-	16411,
-	16474,
-	16474,
-	16474,
-	16489,
-	16498,
-	16504,
-	16504,
-	16531,
-	16531,
-	16531,
-	16534,
-	16581,
-	16596,
-	16600,
-	16647,
-	16647,
-	16647,
-	16653,
-	16662,
-	16666,
-	16668,
-	16689,
-	16707,
-	16707,
-	16722,
-	16724,
-	16728,
-	16728,
-	16728,
-	16752,
-	16773,
-	16777,
-	16778,
-	16778,
-	16903,
-	17155,
-	17161,
-	17176,
-	17436,
-	17492,
-	17541,
-	17556,
-	17560,
-	17681,
-	17684,
-	17729,
-	17729,
-	17796,
-	17923,
-	17925,
-	17944,
-	18049,
-	18439,
-	18443,
-	18445,
-	18445,
-	18454,
-	18457,
-	18458,
-	18458,
-	18458,
-	18460,
-	18469,
-	18469,
-	18473,
-	18473,
-	18499,
-	18505,
-	18513,
-	18513,
-	18514,
-	18514,
-	18520,
-	18520,
-	18544,
-	18565,
-	18565,
-	18565,
-	18569,
-	18569,
-	18572,
-	18577,
-	18577,
-	18580,
-	18580,
-	18580,
-	18580,
-	18584,
-	18584,
-	18640,
-	18691,
-	18691,
-	18691,
-	18694,
-	18697,
-	18697,
-	18697,
-	18697,
-	18700,
-	18706,
-	18708,
-	18712,
-	18712,
-	18721,
-	18721,
-	18724,
-	18736,
-	18753,
-	18756,
-	18760,
-	18768,
-	18817,
-	18820,
-	18820,
-	18820,
-	18820,
-	18832,
-	18968,
-	19461,
-	19462,
-	19473,
-	19474,
-	19476,
-	19492,
-	19713,
-	19713,
-	19714,
-	20491,
-	20491,
-	20493,
-	20501,
-	20501,
-	20502,
-	20506,
-	20506,
-	20508,
-	20553,
-	20556,
-	20561,
-	20562,
-	20568,
-	20611,
-	20611,
-	20613,
-	20613,
-	20625,
-	20628,
-	20632,
-	20673,
-	20745,
-	20748,
-	20748,
-	20754,
-	20760,
-	20776,
-	20801,
-	20801,
-	20804,
-	20868,
-	20995,
-	21250,
-	21521,
-	21524,
-	21761,
-	21762,
-	22533,
-	22533,
-	22534,
-	22537,
-	22537,
-	22545,
-	22545,
-	22546,
-	22546,
-	22548,
-	22552,
-	22593,
-	22608,
-	22608,
-	22608,
-	22657,
-	22672,
-	22672,
-	22786,
-	22786,
-	22800,
-	22848,
-	23553,
-	23568,
-	23808,
-	23808,
-	24583,
-	24583,
-	24587,
-	24587,
-	24589,
-	24595,
-	24597,
-	24597,
-	24597,
-	24598,
-	24601,
-	24602,
-	24602,
-	24604,
-	24604,
-	24604,
-	24643,
-	24643,
-	24643,
-	24645,
-	24649,
-	24649,
-	24649,
-	24657,
-	24657,
-	24660,
-	24673,
-	24673,
-	24709,
-	24709,
-	24713,
-	24724,
-	24724,
-	24728,
-	24752,
-	24769,
-	24769,
-	24784,
-	24837,
-	24837,
-	24837,
-	24841,
-	24841,
-	24841,
-	24841,
-	24850,
-	24856,
-	24856,
-	24856,
-	24897,
-	24897,
-	24897,
-	24898,
-	24898,
-	24900,
-	24900,
-	24900,
-	24904,
-	24904,
-	24904,
-	24904,
-	24912,
-	24928,
-	24961,
-	24964,
-	24968,
-	25024,
-	25024,
-	25091,
-	25093,
-	25217,
-	25217,
-	25408,
-	25603,
-	25617,
-	25624,
-	25624,
-	25729,
-	25732,
-	25736,
-	25744,
-	25857,
-	25857,
-	25872,
-	25872,
-	26627,
-	26629,
-	26629,
-	26633,
-	26633,
-	26634,
-	26641,
-	26641,
-	26641,
-	26642,
-	26642,
-	26644,
-	26644,
-	26648,
-	26648,
-	26672,
-	26689,
-	26689,
-	26689,
-	26689,
-	26689,
-	26689,
-	26689,
-	26692,
-	26704,
-	26704,
-	26720,
-	26753,
-	26881,
-	26881,
-	26881,
-	26884,
-	26884,
-	26884,
-	26888,
-	26888,
-	26896,
-	26896,
-	26896,
-	26896,
-	26944,
-	26944,
-	27649,
-	27652,
-	27712,
-	27904,
-	28675,
-	28677,
-	28677,
-	28677,
-	28681,
-	28681,
-	28681,
-	28692,
-	28696,
-	28696,
-	28696,
-	28737,
-	28737,
-	28737,
-	28752,
-	28752,
-	28752,
-	28929,
-	28929,
-	28929,
-	28929,
-	28929,
-	28929,
-	28932,
-	28932,
-	28944,
-	28944,
-	28992,
-	30721,
-	30721,
-	30736,
-	30736,
-	30736,
-	32791,
-	32797,
-	32797,
-	32797,
-	32857,
-	32857,
-	32857,
-	32915,
-	32917,
-	32917,
-	32917,
-	32977,
-	33045,
-	33045,
-	33046,
-	33050,
-	33050,
-	33161,
-	33305,
-	34072,
-	34835,
-	34837,
-	34837,
-	34837,
-	34841,
-	34841,
-	34841,
-	34841,
-	34897,
-	34913,
-	34949,
-	34961,
-	34961,
-	34964,
-	34968,
-	35075,
-	35077,
-	35077,
-	35081,
-	35081,
-	35089,
-	35096,
-	35096,
-	35096,
-	35096,
-	35105,
-	35120,
-	35201,
-	35204,
-	35845,
-	35860,
-	36097,
-	36112,
-	36112,
-	36885,
-	36945,
-	36997,
-	37125,
-	37144,
-	37249,
-	37249,
-	37252,
-	38917,
-	38929,
-	38929,
-	38929,
-	38945,
-	39169,
-	39170,
-	39184,
-	39200,
-	40979,
-	40981,
-	40985,
-	40985,
-	41041,
-	41105,
-	41221,
-	41225,
-	41225,
-	41233,
-	41233,
-	41233,
-	41240,
-	41240,
-	41281,
-	41281,
-	41281,
-	41296,
-	41296,
-	41296,
-	41348,
-	42001,
-	42001,
-	42256,
-	43025,
-	43025,
-	43025,
-	43025,
-	43025,
-	43025,
-	43073,
-	43265,
-	43265,
-	43265,
-	43265,
-	44033,
-	44288,
-	45313,
-	45328,
-	49180,
-	49202,
-	49225,
-	49240,
-	49285,
-	49285,
-	49285,
-	49300,
-	49300,
-	49304,
-	49304,
-	49304,
-	49413,
-	49417,
-	49418,
-	49428,
-	49540,
-	49552,
-	50196,
-	50200,
-	50241,
-	50305,
-	50433,
-	50448,
-	50704,
-	51203,
-	51203,
-	51205,
-	51209,
-	51217,
-	51220,
-	51224,
-	51224,
-	51265,
-	51280,
-	51336,
-	51457,
-	51713,
-	51728,
-	52225,
-	52228,
-	52480,
-	53253,
-	53260,
-	53266,
-	53272,
-	53284,
-	53377,
-	53380,
-	54273,
-	55297,
-	55297,
-	55298,
-	55300,
-	55312,
-	55312,
-	57349,
-	57349,
-	57349,
-	57361,
-	57364,
-	57364,
-	57409,
-	57424,
-	57473,
-	57473,
-	57488,
-	57488,
-	57601,
-	57608,
-	57616,
-	57664,
-	57664,
-	57664,
-	57857,
-	58369,
-	58624,
-	59393,
-	59393,
-	59393,
-	59408,
-	59408,
-	59648,
-	60416,
-	61441,
-	61441,
-	67843,
-	131095,
-	131095,
-	131095,
-	131095,
-	131099,
-	131099,
-	131099,
-	131099,
-	131099,
-	131099,
-	131101,
-	131101,
-	131101,
-	131101,
-	131101,
-	131101,
-	131101,
-	131101,
-	131101,
-	131125,
-	131125,
-	131129,
-	131129,
-	131129,
-	131155,
-	131155,
-	131155,
-	131155,
-	131157,
-	131157,
-	131157,
-	131161,
-	131161,
-	131161,
-	131161,
-	131161,
-	131185,
-	131207,
-	131213,
-	131213,
-	131219,
-	131221,
-	131221,
-	131221,
-	131221,
-	131221,
-	131221,
-	131221,
-	131225,
-	131225,
-	131225,
-	131225,
-	131237,
-	131241,
-	131267,
-	131281,
-	131281,
-	131282,
-	131335,
-	131335,
-	131335,
-	131339,
-	131339,
-	131339,
-	131339,
-	131341,
-	131341,
-	131341,
-	131341,
-	131341,
-	131341,
-	131347,
-	131347,
-	131347,
-	131347,
-	131349,
-	131349,
-	131349,
-	131349,
-	131349,
-	131349,
-	131353,
-	131353,
-	131353,
-	131353,
-	131353,
-	131354,
-	131354,
-	131354,
-	131354,
-	131354,
-	131356,
-	131356,
-	131356,
-	131356,
-	131356,
-	131363,
-	131365,
-	131365,
-	131365,
-	131369,
-	131369,
-	131377,
-	131377,
-	131377,
-	131378,
-	131378,
-	131378,
-	131378,
-	131384,
-	131384,
-	131395,
-	131395,
-	131397,
-	131397,
-	131397,
-	131401,
-	131409,
-	131409,
-	131409,
-	131409,
-	131409,
-	131410,
-	131412,
-	131416,
-	131416,
-	131416,
-	131416,
-	131416,
-	131432,
-	131440,
-	131459,
-	131459,
-	131461,
-	131461,
-	131462,
-	131473,
-	131473,
-	131476,
-	131476,
-	131476,
-	131476,
-	131480,
-	131480,
-	131480,
-	131480,
-	131521,
-	131536,
-	131609,
-	131609,
-	131665,
-	131843,
-	131858,
-	131858,
-	131864,
-	131873,
-	131905,
-	131905,
-	131905,
-	131920,
-	131969,
-	132103,
-	132115,
-	132115,
-	132115,
-	132115,
-	132117,
-	132117,
-	132117,
-	132117,
-	132118,
-	132121,
-	132121,
-	132121,
-	132121,
-	132121,
-	132124,
-	132133,
-	132145,
-	132145,
-	132148,
-	132229,
-	132229,
-	132244,
-	132355,
-	132357,
-	132358,
-	132361,
-	132369,
-	132369,
-	132370,
-	132370,
-	132372,
-	132372,
-	132376,
-	132376,
-	132385,
-	132385,
-	132385,
-	132385,
-	132400,
-	132400,
-	132432,
-	132481,
-	132484,
-	132488,
-	132496,
-	133139,
-	133139,
-	133139,
-	133139,
-	133139,
-	133141,
-	133141,
-	133141,
-	133141,
-	133141,
-	133145,
-	133145,
-	133145,
-	133145,
-	133169,
-	133169,
-	133169,
-	133169,
-	133201,
-	133201,
-	133201,
-	133201,
-	133201,
-	133201,
-	133201,
-	133201,
-	133253,
-	133265,
-	133265,
-	133379,
-	133379,
-	133379,
-	133381,
-	133381,
-	133385,
-	133385,
-	133385,
-	133385,
-	133385,
-	133393,
-	133394,
-	133394,
-	133394,
-	133394,
-	133396,
-	133396,
-	133396,
-	133400,
-	133400,
-	133409,
-	133409,
-	133409,
-	133424,
-	133424,
-	133424,
-	133424,
-	133424,
-	133441,
-	133441,
-	133441,
-	133456,
-	133456,
-	133456,
-	133456,
-	133505,
-	133505,
-	133508,
-	134149,
-	134161,
-	134161,
-	134164,
-	134416,
-	134416,
-	135187,
-	135187,
-	135187,
-	135187,
-	135187,
-	135187,
-	135189,
-	135189,
-	135193,
-	135193,
-	135193,
-	135193,
-	135193,
-	135193,
-	135217,
-	135217,
-	135224,
-	135249,
-	135249,
-	135249,
-	135249,
-	135299,
-	135301,
-	135301,
-	135313,
-	135313,
-	135313,
-	135316,
-	135376,
-	135427,
-	135427,
-	135427,
-	135429,
-	135429,
-	135429,
-	135433,
-	135433,
-	135441,
-	135441,
-	135441,
-	135441,
-	135441,
-	135442,
-	135444,
-	135444,
-	135448,
-	135448,
-	135448,
-	135448,
-	135457,
-	135457,
-	135472,
-	135504,
-	135504,
-	135504,
-	135553,
-	135553,
-	135553,
-	135553,
-	135556,
-	135568,
-	136209,
-	136209,
-	136209,
-	136336,
-	136449,
-	136449,
-	137233,
-	137233,
-	137281,
-	137473,
-	137473,
-	137473,
-	137488,
-	137488,
-	137488,
-	139275,
-	139283,
-	139283,
-	139283,
-	139285,
-	139285,
-	139285,
-	139285,
-	139285,
-	139285,
-	139285,
-	139289,
-	139289,
-	139289,
-	139289,
-	139289,
-	139289,
-	139301,
-	139313,
-	139313,
-	139320,
-	139333,
-	139337,
-	139337,
-	139345,
-	139345,
-	139345,
-	139345,
-	139345,
-	139345,
-	139352,
-	139397,
-	139523,
-	139523,
-	139523,
-	139523,
-	139523,
-	139525,
-	139525,
-	139525,
-	139525,
-	139529,
-	139529,
-	139529,
-	139529,
-	139529,
-	139529,
-	139537,
-	139537,
-	139537,
-	139538,
-	139538,
-	139538,
-	139540,
-	139540,
-	139540,
-	139544,
-	139544,
-	139544,
-	139553,
-	139553,
-	139568,
-	139568,
-	139585,
-	139585,
-	139585,
-	139585,
-	139586,
-	139592,
-	139600,
-	139600,
-	139600,
-	139600,
-	139600,
-	139600,
-	139600,
-	139649,
-	139652,
-	139664,
-	139664,
-	139664,
-	140291,
-	140293,
-	140297,
-	140305,
-	140305,
-	140305,
-	140305,
-	140305,
-	140321,
-	140353,
-	140353,
-	140368,
-	140545,
-	140545,
-	140545,
-	140545,
-	140545,
-	140546,
-	140548,
-	140552,
-	140560,
-	140560,
-	141329,
-	141329,
-	141329,
-	141377,
-	141569,
-	141569,
-	141584,
-	142337,
-	143377,
-	143377,
-	143377,
-	143489,
-	143617,
-	143617,
-	143632,
-	143632,
-	147463,
-	147463,
-	147463,
-	147463,
-	147467,
-	147467,
-	147467,
-	147467,
-	147467,
-	147467,
-	147469,
-	147469,
-	147477,
-	147478,
-	147481,
-	147481,
-	147481,
-	147482,
-	147482,
-	147482,
-	147482,
-	147484,
-	147484,
-	147484,
-	147484,
-	147497,
-	147505,
-	147508,
-	147512,
-	147523,
-	147525,
-	147529,
-	147529,
-	147529,
-	147537,
-	147538,
-	147538,
-	147540,
-	147540,
-	147540,
-	147544,
-	147544,
-	147544,
-	147568,
-	147568,
-	147587,
-	147589,
-	147589,
-	147589,
-	147589,
-	147589,
-	147590,
-	147593,
-	147593,
-	147596,
-	147601,
-	147601,
-	147604,
-	147604,
-	147604,
-	147604,
-	147608,
-	147650,
-	147650,
-	147650,
-	147656,
-	147715,
-	147717,
-	147717,
-	147717,
-	147718,
-	147718,
-	147718,
-	147721,
-	147721,
-	147721,
-	147722,
-	147722,
-	147724,
-	147745,
-	147746,
-	147752,
-	147760,
-	147777,
-	147780,
-	147780,
-	147780,
-	147784,
-	147841,
-	147841,
-	147844,
-	147844,
-	147844,
-	147992,
-	148008,
-	148048,
-	148240,
-	148483,
-	148485,
-	148485,
-	148486,
-	148497,
-	148498,
-	148500,
-	148500,
-	148500,
-	148500,
-	148516,
-	148609,
-	148624,
-	148737,
-	148752,
-	148800,
-	148993,
-	149008,
-	149507,
-	149507,
-	149507,
-	149507,
-	149507,
-	149509,
-	149509,
-	149509,
-	149509,
-	149509,
-	149509,
-	149521,
-	149521,
-	149522,
-	149522,
-	149522,
-	149524,
-	149528,
-	149528,
-	149537,
-	149552,
-	149552,
-	149569,
-	149569,
-	149569,
-	149569,
-	149569,
-	149584,
-	149584,
-	149633,
-	149633,
-	149633,
-	149636,
-	149648,
-	149762,
-	149764,
-	149768,
-	149776,
-	149776,
-	149776,
-	149824,
-	150017,
-	151555,
-	151555,
-	151557,
-	151557,
-	151557,
-	151557,
-	151564,
-	151569,
-	151570,
-	151570,
-	151570,
-	151572,
-	151572,
-	151576,
-	151576,
-	151576,
-	151585,
-	151585,
-	151600,
-	151617,
-	151617,
-	151617,
-	151632,
-	151681,
-	151681,
-	151682,
-	151696,
-	151696,
-	151696,
-	151809,
-	151809,
-	151809,
-	151810,
-	151812,
-	151812,
-	151812,
-	151824,
-	151824,
-	151936,
-	152065,
-	152065,
-	152065,
-	152577,
-	152577,
-	152577,
-	152592,
-	153601,
-	153601,
-	153601,
-	153616,
-	153616,
-	153856,
-	155651,
-	155651,
-	155653,
-	155653,
-	155653,
-	155653,
-	155653,
-	155653,
-	155654,
-	155657,
-	155657,
-	155657,
-	155657,
-	155657,
-	155665,
-	155666,
-	155666,
-	155668,
-	155668,
-	155668,
-	155668,
-	155668,
-	155672,
-	155672,
-	155684,
-	155688,
-	155696,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155713,
-	155720,
-	155728,
-	155728,
-	155728,
-	155728,
-	155777,
-	155777,
-	155777,
-	155780,
-	155792,
-	155792,
-	155905,
-	155905,
-	155906,
-	155906,
-	155906,
-	155908,
-	155908,
-	155908,
-	155908,
-	155912,
-	155920,
-	155920,
-	155920,
-	155968,
-	155968,
-	155968,
-	156032,
-	156673,
-	156673,
-	156673,
-	156674,
-	156676,
-	156688,
-	156688,
-	156688,
-	156928,
-	157697,
-	157697,
-	157712,
-	157712,
-	157712,
-	157712,
-	157952,
-	159745,
-	159745,
-	159745,
-	159745,
-	159745,
-	159760,
-	159760,
-	159760,
-	160000,
-	160000,
-	163861,
-	163861,
-	163861,
-	163861,
-	163861,
-	163861,
-	163865,
-	163865,
-	163865,
-	163865,
-	163865,
-	163865,
-	163889,
-	163921,
-	163921,
-	163921,
-	163921,
-	163973,
-	163985,
-	163985,
-	163985,
-	163988,
-	164033,
-	164101,
-	164101,
-	164101,
-	164101,
-	164105,
-	164105,
-	164105,
-	164105,
-	164113,
-	164116,
-	164116,
-	164116,
-	164120,
-	164120,
-	164120,
-	164120,
-	164161,
-	164176,
-	164176,
-	164228,
-	164228,
-	164240,
-	164288,
-	164369,
-	165124,
-	165136,
-	165136,
-	165905,
-	165905,
-	165905,
-	165905,
-	165905,
-	165905,
-	165905,
-	165905,
-	166017,
-	166145,
-	166145,
-	166145,
-	166145,
-	166160,
-	166160,
-	166160,
-	167941,
-	167953,
-	167953,
-	168001,
-	168065,
-	168065,
-	168193,
-	168193,
-	168193,
-	168193,
-	168196,
-	168208,
-	168208,
-	168256,
-	172041,
-	172049,
-	172049,
-	172097,
-	172176,
-	172304,
-	172304,
-	172304,
-	172304,
-	173057,
-	173312,
-	180229,
-	180233,
-	180233,
-	180233,
-	180241,
-	180242,
-	180242,
-	180244,
-	180248,
-	180248,
-	180248,
-	180248,
-	180289,
-	180304,
-	180304,
-	180353,
-	180353,
-	180353,
-	180356,
-	180368,
-	180368,
-	180481,
-	180496,
-	180544,
-	180608,
-	181264,
-	181264,
-	182273,
-	182273,
-	182273,
-	182273,
-	182276,
-	182288,
-	182288,
-	182288,
-	182528,
-	184336,
-	184336,
-	184336,
-	184336,
-	184448,
-	184576,
-	188417,
-	188420,
-	188432,
-	188480,
-	188672,
-	188672,
-	196897,
-	200961,
-	262171,
-	262171,
-	262171,
-	262173,
-	262173,
-	262173,
-	262195,
-	262197,
-	262197,
-	262201,
-	262229,
-	262233,
-	262233,
-	262233,
-	262285,
-	262285,
-	262293,
-	262293,
-	262297,
-	262297,
-	262297,
-	262297,
-	262297,
-	262297,
-	262321,
-	262324,
-	262407,
-	262407,
-	262413,
-	262413,
-	262413,
-	262413,
-	262413,
-	262419,
-	262419,
-	262421,
-	262421,
-	262422,
-	262425,
-	262425,
-	262425,
-	262425,
-	262426,
-	262428,
-	262428,
-	262437,
-	262452,
-	262456,
-	262456,
-	262467,
-	262473,
-	262481,
-	262481,
-	262482,
-	262531,
-	262533,
-	262533,
-	262537,
-	262548,
-	262548,
-	262552,
-	262552,
-	262552,
-	262552,
-	262561,
-	262681,
-	262801,
-	262930,
-	263041,
-	263175,
-	263187,
-	263187,
-	263187,
-	263189,
-	263190,
-	263193,
-	263196,
-	263205,
-	263217,
-	263220,
-	263252,
-	263301,
-	263301,
-	263305,
-	263313,
-	263313,
-	263316,
-	263427,
-	263433,
-	263436,
-	263442,
-	263442,
-	263444,
-	263448,
-	263448,
-	263457,
-	263472,
-	263472,
-	263553,
-	263553,
-	263553,
-	263556,
-	263556,
-	263568,
-	263568,
-	263685,
-	263697,
-	264203,
-	264205,
-	264205,
-	264211,
-	264211,
-	264211,
-	264211,
-	264213,
-	264213,
-	264213,
-	264213,
-	264213,
-	264213,
-	264217,
-	264217,
-	264217,
-	264217,
-	264217,
-	264217,
-	264227,
-	264229,
-	264229,
-	264241,
-	264241,
-	264241,
-	264241,
-	264244,
-	264248,
-	264261,
-	264265,
-	264273,
-	264273,
-	264280,
-	264280,
-	264289,
-	264323,
-	264323,
-	264325,
-	264337,
-	264337,
-	264337,
-	264337,
-	264337,
-	264337,
-	264337,
-	264337,
-	264337,
-	264344,
-	264353,
-	264368,
-	264368,
-	264400,
-	264451,
-	264451,
-	264451,
-	264453,
-	264453,
-	264453,
-	264457,
-	264457,
-	264457,
-	264465,
-	264465,
-	264466,
-	264466,
-	264466,
-	264468,
-	264468,
-	264468,
-	264468,
-	264472,
-	264472,
-	264472,
-	264472,
-	264472,
-	264472,
-	264481,
-	264481,
-	264484,
-	264496,
-	264496,
-	264496,
-	264513,
-	264513,
-	264513,
-	264520,
-	264528,
-	264528,
-	264528,
-	264528,
-	264577,
-	264577,
-	264577,
-	264578,
-	264580,
-	264592,
-	264592,
-	264592,
-	264608,
-	264961,
-	265219,
-	265221,
-	265221,
-	265221,
-	265225,
-	265233,
-	265233,
-	265233,
-	265233,
-	265233,
-	265233,
-	265236,
-	265249,
-	265264,
-	265345,
-	265473,
-	265473,
-	265473,
-	265474,
-	265476,
-	265476,
-	265488,
-	265504,
-	265536,
-	266259,
-	266259,
-	266261,
-	266261,
-	266261,
-	266265,
-	266265,
-	266265,
-	266265,
-	266289,
-	266307,
-	266321,
-	266321,
-	266373,
-	266373,
-	266373,
-	266377,
-	266385,
-	266385,
-	266385,
-	266385,
-	266385,
-	266385,
-	266499,
-	266499,
-	266499,
-	266501,
-	266501,
-	266501,
-	266505,
-	266505,
-	266505,
-	266513,
-	266514,
-	266516,
-	266516,
-	266516,
-	266520,
-	266520,
-	266520,
-	266561,
-	266561,
-	266625,
-	266628,
-	266640,
-	266640,
-	266755,
-	266769,
-	267269,
-	267269,
-	267281,
-	267281,
-	267281,
-	267521,
-	267521,
-	267524,
-	267536,
-	267536,
-	268291,
-	268291,
-	268291,
-	268293,
-	268293,
-	268305,
-	268305,
-	268305,
-	268305,
-	268305,
-	268305,
-	268305,
-	268305,
-	268305,
-	268312,
-	268321,
-	268417,
-	268432,
-	268545,
-	268545,
-	268545,
-	268545,
-	268545,
-	268545,
-	268546,
-	268548,
-	268560,
-	268560,
-	268560,
-	268560,
-	268560,
-	268576,
-	268608,
-	269568,
-	270347,
-	270355,
-	270355,
-	270355,
-	270357,
-	270357,
-	270357,
-	270361,
-	270361,
-	270361,
-	270361,
-	270361,
-	270361,
-	270362,
-	270364,
-	270385,
-	270385,
-	270385,
-	270392,
-	270403,
-	270409,
-	270417,
-	270417,
-	270433,
-	270469,
-	270473,
-	270481,
-	270481,
-	270481,
-	270481,
-	270482,
-	270488,
-	270529,
-	270529,
-	270529,
-	270529,
-	270544,
-	270595,
-	270595,
-	270595,
-	270597,
-	270597,
-	270597,
-	270597,
-	270601,
-	270601,
-	270602,
-	270604,
-	270609,
-	270609,
-	270609,
-	270609,
-	270610,
-	270610,
-	270610,
-	270612,
-	270612,
-	270612,
-	270616,
-	270616,
-	270616,
-	270616,
-	270625,
-	270625,
-	270632,
-	270640,
-	270640,
-	270657,
-	270657,
-	270664,
-	270672,
-	270672,
-	270672,
-	270721,
-	270721,
-	270724,
-	270728,
-	270736,
-	270736,
-	270736,
-	270784,
-	270784,
-	270865,
-	270865,
-	271112,
-	271363,
-	271365,
-	271369,
-	271377,
-	271377,
-	271377,
-	271377,
-	271380,
-	271380,
-	271408,
-	271489,
-	271489,
-	271489,
-	271489,
-	271617,
-	271617,
-	271620,
-	271620,
-	271624,
-	271624,
-	271632,
-	271632,
-	271648,
-	271680,
-	271680,
-	271744,
-	272128,
-	272389,
-	272393,
-	272401,
-	272401,
-	272401,
-	272401,
-	272401,
-	272401,
-	272402,
-	272408,
-	272417,
-	272449,
-	272449,
-	272464,
-	272641,
-	272641,
-	272641,
-	272641,
-	272641,
-	272656,
-	272656,
-	272656,
-	272656,
-	272656,
-	272656,
-	272656,
-	272704,
-	272704,
-	273409,
-	273409,
-	273664,
-	273664,
-	273664,
-	274441,
-	274441,
-	274449,
-	274449,
-	274449,
-	274449,
-	274449,
-	274449,
-	274449,
-	274449,
-	274449,
-	274456,
-	274689,
-	274689,
-	274689,
-	274689,
-	274696,
-	274704,
-	274704,
-	275457,
-	275472,
-	275712,
-	275712,
-	276736,
-	278541,
-	278541,
-	278541,
-	278554,
-	278556,
-	278556,
-	278556,
-	278569,
-	278584,
-	278601,
-	278601,
-	278601,
-	278609,
-	278616,
-	278625,
-	278661,
-	278661,
-	278662,
-	278665,
-	278665,
-	278673,
-	278673,
-	278676,
-	278676,
-	278676,
-	278680,
-	278680,
-	278680,
-	278787,
-	278793,
-	278796,
-	278796,
-	278802,
-	278802,
-	278804,
-	278808,
-	278808,
-	278808,
-	278808,
-	278817,
-	278820,
-	278824,
-	278832,
-	278849,
-	278913,
-	278928,
-	278976,
-	279312,
-	279424,
-	279424,
-	279558,
-	279561,
-	279564,
-	279572,
-	279572,
-	279617,
-	279681,
-	279681,
-	279684,
-	279684,
-	279696,
-	279696,
-	279809,
-	279812,
-	279936,
-	280065,
-	280068,
-	280080,
-	280579,
-	280581,
-	280581,
-	280582,
-	280582,
-	280585,
-	280588,
-	280588,
-	280588,
-	280593,
-	280593,
-	280593,
-	280593,
-	280594,
-	280594,
-	280596,
-	280596,
-	280596,
-	280596,
-	280600,
-	280600,
-	280600,
-	280609,
-	280609,
-	280609,
-	280612,
-	280616,
-	280624,
-	280641,
-	280641,
-	280642,
-	280644,
-	280648,
-	280656,
-	280656,
-	280656,
-	280656,
-	280672,
-	280672,
-	280705,
-	280705,
-	280705,
-	280708,
-	280708,
-	280712,
-	280720,
-	280720,
-	280720,
-	280720,
-	280736,
-	280833,
-	280833,
-	280834,
-	280834,
-	280834,
-	280836,
-	280840,
-	280840,
-	280840,
-	280840,
-	280840,
-	280840,
-	280840,
-	280864,
-	280896,
-	281096,
-	281104,
-	281601,
-	281601,
-	281601,
-	281604,
-	281604,
-	281616,
-	281616,
-	281632,
-	281728,
-	281728,
-	281728,
-	281856,
-	281856,
-	282627,
-	282627,
-	282629,
-	282630,
-	282642,
-	282642,
-	282644,
-	282648,
-	282648,
-	282648,
-	282657,
-	282672,
-	282689,
-	282756,
-	282768,
-	282884,
-	282888,
-	282896,
-	282912,
-	282944,
-	282944,
-	283137,
-	283649,
-	283649,
-	283652,
-	283652,
-	283664,
-	283664,
-	283904,
-	284673,
-	284673,
-	284673,
-	284673,
-	284680,
-	284688,
-	284688,
-	284688,
-	284736,
-	284800,
-	284928,
-	284928,
-	284928,
-	286723,
-	286725,
-	286725,
-	286725,
-	286725,
-	286729,
-	286730,
-	286737,
-	286738,
-	286738,
-	286740,
-	286740,
-	286740,
-	286740,
-	286740,
-	286744,
-	286744,
-	286744,
-	286744,
-	286753,
-	286760,
-	286785,
-	286785,
-	286786,
-	286792,
-	286800,
-	286800,
-	286849,
-	286864,
-	286864,
-	286864,
-	286880,
-	286912,
-	286978,
-	286978,
-	286980,
-	286980,
-	286980,
-	286980,
-	286980,
-	286980,
-	286980,
-	286984,
-	286984,
-	286992,
-	286992,
-	287008,
-	287008,
-	287040,
-	287040,
-	287233,
-	287233,
-	287233,
-	287233,
-	287248,
-	287360,
-	287488,
-	287745,
-	287745,
-	287746,
-	287746,
-	287748,
-	287748,
-	287748,
-	287760,
-	287760,
-	287760,
-	287760,
-	287872,
-	288000,
-	288000,
-	288000,
-	288000,
-	288000,
-	288769,
-	288769,
-	288769,
-	288769,
-	288772,
-	288784,
-	288784,
-	288784,
-	288784,
-	288784,
-	288832,
-	289024,
-	289024,
-	289024,
-	289024,
-	289024,
-	289024,
-	289792,
-	290817,
-	290817,
-	290817,
-	290817,
-	290817,
-	290817,
-	290817,
-	290832,
-	290832,
-	290832,
-	290832,
-	290832,
-	290832,
-	291072,
-	291072,
-	291072,
-	291840,
-	294933,
-	294933,
-	294933,
-	294933,
-	294937,
-	294937,
-	294937,
-	294937,
-	294937,
-	294993,
-	294993,
-	294993,
-	295045,
-	295045,
-	295045,
-	295057,
-	295057,
-	295057,
-	295057,
-	295057,
-	295060,
-	295173,
-	295173,
-	295173,
-	295177,
-	295177,
-	295177,
-	295185,
-	295185,
-	295188,
-	295188,
-	295188,
-	295192,
-	295192,
-	295297,
-	295297,
-	295297,
-	295297,
-	295297,
-	295300,
-	295312,
-	295441,
-	295441,
-	295941,
-	295941,
-	295953,
-	295953,
-	295953,
-	295953,
-	295956,
-	295956,
-	296065,
-	296193,
-	296193,
-	296193,
-	296193,
-	296196,
-	296196,
-	296208,
-	296208,
-	296208,
-	296965,
-	296965,
-	296965,
-	296969,
-	296969,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296977,
-	296978,
-	296980,
-	296993,
-	297008,
-	297089,
-	297104,
-	297104,
-	297217,
-	297217,
-	297217,
-	297217,
-	297217,
-	297217,
-	297217,
-	297218,
-	297220,
-	297232,
-	297232,
-	297232,
-	297232,
-	297232,
-	297232,
-	297232,
-	297232,
-	297248,
-	298000,
-	298000,
-	298000,
-	299013,
-	299013,
-	299017,
-	299073,
-	299137,
-	299137,
-	299152,
-	299265,
-	299265,
-	299265,
-	299272,
-	299328,
-	300048,
-	300048,
-	300288,
-	301057,
-	301057,
-	301057,
-	301057,
-	301057,
-	301312,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303121,
-	303128,
-	303128,
-	303128,
-	303169,
-	303169,
-	303361,
-	303361,
-	303361,
-	303361,
-	303361,
-	303361,
-	303361,
-	303361,
-	303376,
-	303376,
-	303376,
-	303376,
-	303376,
-	303376,
-	303424,
-	304129,
-	304129,
-	304384,
-	304384,
-	305153,
-	311301,
-	311301,
-	311301,
-	311301,
-	311305,
-	311305,
-	311305,
-	311313,
-	311313,
-	311313,
-	311316,
-	311316,
-	311316,
-	311316,
-	311320,
-	311320,
-	311320,
-	311425,
-	311425,
-	311428,
-	311440,
-	311440,
-	311440,
-	311553,
-	311553,
-	311553,
-	311556,
-	311556,
-	311560,
-	311568,
-	311680,
-	311680,
-	312064,
-	312324,
-	312324,
-	312336,
-	312336,
-	312448,
-	312576,
-	313345,
-	313345,
-	313348,
-	313352,
-	313360,
-	313360,
-	313360,
-	313360,
-	313360,
-	313360,
-	313376,
-	313408,
-	313600,
-	313600,
-	314368,
-	315393,
-	315396,
-	315408,
-	315408,
-	315408,
-	315408,
-	319489,
-	319496,
-	319504,
-	319504,
-	319504,
-	319552,
-	319616,
-	319744,
-	319744,
-	320512,
-	320512,
-	327939,
-	327945,
-	376960,
-	393223,
-	393223,
-	393227,
-	393227,
-	393227,
-	393227,
-	393229,
-	393235,
-	393235,
-	393235,
-	393235,
-	393235,
-	393235,
-	393235,
-	393235,
-	393235,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393237,
-	393241,
-	393241,
-	393241,
-	393241,
-	393251,
-	393253,
-	393257,
-	393265,
-	393265,
-	393265,
-	393265,
-	393265,
-	393283,
-	393283,
-	393283,
-	393285,
-	393285,
-	393289,
-	393289,
-	393297,
-	393297,
-	393297,
-	393297,
-	393297,
-	393297,
-	393297,
-	393298,
-	393304,
-	393313,
-	393347,
-	393347,
-	393349,
-	393349,
-	393353,
-	393353,
-	393361,
-	393361,
-	393361,
-	393361,
-	393361,
-	393361,
-	393361,
-	393362,
-	393368,
-	393368,
-	393368,
-	393377,
-	393392,
-	393409,
-	393475,
-	393475,
-	393475,
-	393475,
-	393478,
-	393481,
-	393481,
-	393482,
-	393482,
-	393489,
-	393489,
-	393489,
-	393489,
-	393489,
-	393490,
-	393490,
-	393490,
-	393490,
-	393490,
-	393492,
-	393492,
-	393492,
-	393492,
-	393492,
-	393496,
-	393496,
-	393496,
-	393496,
-	393496,
-	393505,
-	393505,
-	393505,
-	393505,
-	393520,
-	393520,
-	393520,
-	393520,
-	393520,
-	393537,
-	393538,
-	393544,
-	393544,
-	393552,
-	393552,
-	393568,
-	393601,
-	393601,
-	393601,
-	393601,
-	393604,
-	393616,
-	393616,
-	393616,
-	393616,
-	393616,
-	393664,
-	393745,
-	394243,
-	394245,
-	394245,
-	394249,
-	394257,
-	394257,
-	394257,
-	394257,
-	394257,
-	394257,
-	394257,
-	394257,
-	394257,
-	394258,
-	394258,
-	394260,
-	394264,
-	394288,
-	394369,
-	394369,
-	394497,
-	394497,
-	394497,
-	394497,
-	394497,
-	394498,
-	394498,
-	394500,
-	394504,
-	394504,
-	394512,
-	394512,
-	394512,
-	394512,
-	394512,
-	394528,
-	394624,
-	394768,
-	395269,
-	395273,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395281,
-	395284,
-	395297,
-	395393,
-	395408,
-	395408,
-	395521,
-	395521,
-	395521,
-	395521,
-	395521,
-	395521,
-	395522,
-	395528,
-	395536,
-	395536,
-	395536,
-	395536,
-	395584,
-	395648,
-	395777,
-	396289,
-	396544,
-	397315,
-	397317,
-	397317,
-	397317,
-	397321,
-	397329,
-	397329,
-	397329,
-	397329,
-	397329,
-	397330,
-	397336,
-	397345,
-	397377,
-	397392,
-	397441,
-	397441,
-	397441,
-	397456,
-	397569,
-	397569,
-	397569,
-	397569,
-	397569,
-	397569,
-	397569,
-	397570,
-	397572,
-	397584,
-	397584,
-	397584,
-	397584,
-	397600,
-	398337,
-	398352,
-	398352,
-	398352,
-	398592,
-	398592,
-	399361,
-	399376,
-	401411,
-	401411,
-	401413,
-	401413,
-	401413,
-	401413,
-	401417,
-	401417,
-	401417,
-	401425,
-	401425,
-	401425,
-	401425,
-	401425,
-	401425,
-	401425,
-	401426,
-	401432,
-	401432,
-	401456,
-	401473,
-	401537,
-	401537,
-	401552,
-	401665,
-	401665,
-	401665,
-	401665,
-	401665,
-	401666,
-	401668,
-	401672,
-	401680,
-	401680,
-	401680,
-	401680,
-	401680,
-	401680,
-	401696,
-	401728,
-	401728,
-	401728,
-	402433,
-	402433,
-	402433,
-	402433,
-	402433,
-	402433,
-	402448,
-	402688,
-	402688,
-	403457,
-	403712,
-	403712,
-	409603,
-	409603,
-	409605,
-	409605,
-	409605,
-	409605,
-	409605,
-	409606,
-	409609,
-	409609,
-	409609,
-	409609,
-	409612,
-	409612,
-	409617,
-	409617,
-	409617,
-	409618,
-	409618,
-	409618,
-	409618,
-	409618,
-	409618,
-	409620,
-	409620,
-	409620,
-	409620,
-	409620,
-	409624,
-	409624,
-	409624,
-	409624,
-	409624,
-	409633,
-	409633,
-	409633,
-	409634,
-	409640,
-	409648,
-	409648,
-	409648,
-	409665,
-	409665,
-	409668,
-	409680,
-	409680,
-	409680,
-	409680,
-	409680,
-	409680,
-	409696,
-	409729,
-	409729,
-	409744,
-	409744,
-	409744,
-	409744,
-	409744,
-	409760,
-	409792,
-	409857,
-	409858,
-	409858,
-	409860,
-	409860,
-	409860,
-	409864,
-	409864,
-	409872,
-	409872,
-	409872,
-	409920,
-	409984,
-	410625,
-	410625,
-	410625,
-	410625,
-	410628,
-	410628,
-	410640,
-	410656,
-	410656,
-	411649,
-	411649,
-	411649,
-	411649,
-	411656,
-	411664,
-	411664,
-	411664,
-	411664,
-	411664,
-	411664,
-	411664,
-	411664,
-	411776,
-	411904,
-	411904,
-	413697,
-	413697,
-	413697,
-	413700,
-	413704,
-	413712,
-	413712,
-	413712,
-	413712,
-	413712,
-	413712,
-	413728,
-	417793,
-	417793,
-	417793,
-	417793,
-	417793,
-	417793,
-	417796,
-	417796,
-	417808,
-	417808,
-	417808,
-	417808,
-	417808,
-	417808,
-	417824,
-	417920,
-	417920,
-	418048,
-	418048,
-	418048,
-	418816,
-	418816,
-	421888,
-	421888,
-	425989,
-	425989,
-	425989,
-	425989,
-	425993,
-	425993,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426001,
-	426017,
-	426049,
-	426049,
-	426113,
-	426113,
-	426113,
-	426241,
-	426241,
-	426241,
-	426241,
-	426241,
-	426241,
-	426244,
-	426244,
-	426244,
-	426248,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426256,
-	426304,
-	426304,
-	426304,
-	426368,
-	427009,
-	427009,
-	427024,
-	427264,
-	430081,
-	430081,
-	430081,
-	430096,
-	430096,
-	430336,
-	430336,
-	434192,
-	434432,
-	442369,
-	442369,
-	442369,
-	442369,
-	442369,
-	442372,
-	442372,
-	442376,
-	442376,
-	442376,
-	442376,
-	442384,
-	442384,
-	442384,
-	442384,
-	442384,
-	442400,
-	442432,
-	442624,
-	442624,
-	443392,
-	444416,
-	446464,
-	446464,
-	450560,
-	458888,
-	524315,
-	524315,
-	524317,
-	524317,
-	524317,
-	524341,
-	524345,
-	524345,
-	524371,
-	524371,
-	524377,
-	524408,
-	524423,
-	524429,
-	524435,
-	524435,
-	524435,
-	524437,
-	524437,
-	524437,
-	524437,
-	524441,
-	524441,
-	524453,
-	524468,
-	524485,
-	524497,
-	524551,
-	524555,
-	524557,
-	524557,
-	524563,
-	524565,
-	524569,
-	524570,
-	524570,
-	524570,
-	524572,
-	524572,
-	524572,
-	524581,
-	524594,
-	524596,
-	524600,
-	524613,
-	524628,
-	524632,
-	524675,
-	524675,
-	524677,
-	524677,
-	524677,
-	524677,
-	524677,
-	524677,
-	524677,
-	524678,
-	524681,
-	524684,
-	524684,
-	524689,
-	524692,
-	524696,
-	524696,
-	524705,
-	524708,
-	524720,
-	524738,
-	524744,
-	524752,
-	524768,
-	524819,
-	524933,
-	525337,
-	525445,
-	525460,
-	525571,
-	525571,
-	525585,
-	525585,
-	525592,
-	525616,
-	525700,
-	525712,
-	525712,
-	526081,
-	526081,
-	526355,
-	526355,
-	526355,
-	526355,
-	526355,
-	526355,
-	526355,
-	526357,
-	526357,
-	526357,
-	526357,
-	526357,
-	526357,
-	526361,
-	526361,
-	526361,
-	526361,
-	526361,
-	526385,
-	526385,
-	526385,
-	526385,
-	526388,
-	526388,
-	526392,
-	526417,
-	526417,
-	526417,
-	526469,
-	526481,
-	526481,
-	526481,
-	526481,
-	526481,
-	526481,
-	526481,
-	526484,
-	526595,
-	526597,
-	526597,
-	526601,
-	526601,
-	526601,
-	526601,
-	526609,
-	526609,
-	526609,
-	526609,
-	526610,
-	526612,
-	526612,
-	526612,
-	526616,
-	526616,
-	526616,
-	526625,
-	526628,
-	526640,
-	526640,
-	526672,
-	526672,
-	526672,
-	526721,
-	526721,
-	526721,
-	526721,
-	526724,
-	526724,
-	526736,
-	526736,
-	526752,
-	526784,
-	526865,
-	527365,
-	527377,
-	527377,
-	527617,
-	527744,
-	528403,
-	528409,
-	528409,
-	528409,
-	528517,
-	528529,
-	528529,
-	528529,
-	528529,
-	528643,
-	528643,
-	528649,
-	528649,
-	528657,
-	528657,
-	528658,
-	528660,
-	528664,
-	528664,
-	528688,
-	528772,
-	528772,
-	528784,
-	528832,
-	530449,
-	530449,
-	530689,
-	532499,
-	532499,
-	532501,
-	532505,
-	532505,
-	532505,
-	532505,
-	532561,
-	532561,
-	532613,
-	532613,
-	532617,
-	532625,
-	532625,
-	532625,
-	532625,
-	532625,
-	532628,
-	532673,
-	532688,
-	532688,
-	532741,
-	532741,
-	532741,
-	532745,
-	532745,
-	532753,
-	532753,
-	532753,
-	532753,
-	532753,
-	532756,
-	532756,
-	532756,
-	532760,
-	532760,
-	532760,
-	532760,
-	532769,
-	532769,
-	532769,
-	532769,
-	532784,
-	532784,
-	532801,
-	532801,
-	532801,
-	532801,
-	532816,
-	532816,
-	532865,
-	532865,
-	532865,
-	532868,
-	532868,
-	532868,
-	532880,
-	532880,
-	532928,
-	532928,
-	533009,
-	533249,
-	533521,
-	533633,
-	533633,
-	533761,
-	533761,
-	533776,
-	533888,
-	534545,
-	534545,
-	534545,
-	534545,
-	534545,
-	534546,
-	534608,
-	534672,
-	534785,
-	534785,
-	534788,
-	534800,
-	534800,
-	534800,
-	534816,
-	534848,
-	535568,
-	536593,
-	536593,
-	536593,
-	536593,
-	536593,
-	536593,
-	536833,
-	536833,
-	536833,
-	536836,
-	536848,
-	536848,
-	536848,
-	540679,
-	540685,
-	540691,
-	540697,
-	540697,
-	540698,
-	540700,
-	540709,
-	540739,
-	540741,
-	540753,
-	540754,
-	540754,
-	540754,
-	540760,
-	540760,
-	540769,
-	540805,
-	540806,
-	540820,
-	540824,
-	540833,
-	540836,
-	540865,
-	540868,
-	540931,
-	540931,
-	540933,
-	540937,
-	540940,
-	540946,
-	540976,
-	540994,
-	540996,
-	541000,
-	541060,
-	541064,
-	541072,
-	541187,
-	541202,
-	541713,
-	541720,
-	541729,
-	541840,
-	542723,
-	542723,
-	542725,
-	542725,
-	542725,
-	542725,
-	542729,
-	542737,
-	542737,
-	542738,
-	542738,
-	542740,
-	542740,
-	542744,
-	542753,
-	542753,
-	542753,
-	542768,
-	542785,
-	542800,
-	542849,
-	542849,
-	542849,
-	542849,
-	542849,
-	542852,
-	542864,
-	542864,
-	542864,
-	542864,
-	542977,
-	542978,
-	542980,
-	542980,
-	542992,
-	542992,
-	542992,
-	543008,
-	543104,
-	543104,
-	543104,
-	543745,
-	543760,
-	543760,
-	544771,
-	544780,
-	544786,
-	544788,
-	544788,
-	544792,
-	544792,
-	544833,
-	544848,
-	544912,
-	545025,
-	545026,
-	545026,
-	545028,
-	545056,
-	546817,
-	546817,
-	546817,
-	546832,
-	546832,
-	546832,
-	548867,
-	548867,
-	548869,
-	548869,
-	548869,
-	548869,
-	548873,
-	548876,
-	548881,
-	548881,
-	548882,
-	548884,
-	548884,
-	548884,
-	548884,
-	548888,
-	548888,
-	548888,
-	548888,
-	548912,
-	548929,
-	548929,
-	548932,
-	548996,
-	548996,
-	549008,
-	549056,
-	549121,
-	549121,
-	549122,
-	549124,
-	549124,
-	549128,
-	549136,
-	549184,
-	549184,
-	549248,
-	549392,
-	549392,
-	549632,
-	549889,
-	549889,
-	549904,
-	550144,
-	550144,
-	550913,
-	550913,
-	550913,
-	550913,
-	550913,
-	550913,
-	550913,
-	550928,
-	550928,
-	551168,
-	552961,
-	552961,
-	552976,
-	552976,
-	553088,
-	553216,
-	553216,
-	553216,
-	557075,
-	557077,
-	557081,
-	557081,
-	557081,
-	557189,
-	557189,
-	557189,
-	557201,
-	557204,
-	557208,
-	557329,
-	557336,
-	557336,
-	557444,
-	557504,
-	559109,
-	559121,
-	559121,
-	559121,
-	559121,
-	559121,
-	559121,
-	559121,
-	559121,
-	559121,
-	559124,
-	559361,
-	559364,
-	559376,
-	561424,
-	562192,
-	565265,
-	565265,
-	565265,
-	565265,
-	565505,
-	565505,
-	565505,
-	565505,
-	565520,
-	565520,
-	565520,
-	567297,
-	573445,
-	573445,
-	573449,
-	573464,
-	573464,
-	573464,
-	573572,
-	573584,
-	573697,
-	573697,
-	573697,
-	573700,
-	573700,
-	573700,
-	573824,
-	575489,
-	575489,
-	575504,
-	575504,
-	575520,
-	575744,
-	575744,
-	577540,
-	577544,
-	577552,
-	577792,
-	581633,
-	581648,
-	581888,
-	581888,
-	581888,
-	581888,
-	598273,
-	655367,
-	655379,
-	655379,
-	655379,
-	655379,
-	655379,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655381,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655385,
-	655397,
-	655397,
-	655401,
-	655409,
-	655409,
-	655409,
-	655409,
-	655441,
-	655441,
-	655441,
-	655441,
-	655441,
-	655441,
-	655441,
-	655457,
-	655491,
-	655493,
-	655493,
-	655493,
-	655505,
-	655505,
-	655505,
-	655505,
-	655505,
-	655506,
-	655506,
-	655508,
-	655508,
-	655512,
-	655521,
-	655521,
-	655536,
-	655553,
-	655619,
-	655619,
-	655621,
-	655621,
-	655621,
-	655625,
-	655625,
-	655633,
-	655633,
-	655633,
-	655633,
-	655633,
-	655633,
-	655634,
-	655634,
-	655634,
-	655634,
-	655636,
-	655636,
-	655636,
-	655636,
-	655636,
-	655640,
-	655640,
-	655640,
-	655649,
-	655649,
-	655656,
-	655664,
-	655664,
-	655681,
-	655681,
-	655696,
-	655696,
-	655696,
-	655712,
-	655745,
-	655745,
-	655746,
-	655746,
-	655748,
-	655748,
-	655748,
-	655752,
-	655760,
-	655760,
-	655760,
-	655776,
-	655776,
-	655808,
-	655808,
-	655808,
-	656389,
-	656401,
-	656401,
-	656417,
-	656641,
-	656641,
-	656641,
-	656641,
-	656644,
-	656656,
-	656656,
-	657411,
-	657413,
-	657425,
-	657425,
-	657425,
-	657425,
-	657425,
-	657425,
-	657425,
-	657425,
-	657665,
-	657665,
-	657665,
-	657666,
-	657680,
-	657680,
-	657680,
-	657680,
-	657696,
-	657792,
-	659473,
-	659473,
-	659473,
-	659473,
-	659473,
-	659473,
-	659473,
-	659473,
-	659473,
-	659504,
-	659585,
-	659585,
-	659600,
-	659713,
-	659713,
-	659713,
-	659713,
-	659713,
-	659713,
-	659728,
-	659728,
-	659728,
-	659728,
-	659728,
-	659728,
-	659728,
-	659840,
-	663555,
-	663561,
-	663569,
-	663569,
-	663569,
-	663569,
-	663569,
-	663570,
-	663576,
-	663576,
-	663617,
-	663809,
-	663809,
-	663809,
-	663809,
-	663809,
-	663809,
-	663824,
-	663824,
-	663824,
-	663824,
-	663824,
-	663824,
-	663872,
-	664577,
-	664832,
-	671747,
-	671747,
-	671747,
-	671747,
-	671749,
-	671749,
-	671749,
-	671749,
-	671749,
-	671749,
-	671749,
-	671749,
-	671753,
-	671753,
-	671761,
-	671761,
-	671761,
-	671764,
-	671768,
-	671768,
-	671768,
-	671777,
-	671780,
-	671792,
-	671792,
-	671792,
-	671792,
-	671809,
-	671809,
-	671809,
-	671809,
-	671824,
-	671824,
-	671824,
-	671824,
-	671824,
-	671873,
-	671874,
-	671874,
-	671876,
-	671876,
-	671876,
-	671876,
-	671888,
-	671888,
-	671888,
-	671888,
-	671888,
-	671904,
-	671904,
-	672001,
-	672001,
-	672002,
-	672004,
-	672004,
-	672008,
-	672064,
-	672064,
-	672512,
-	672769,
-	672769,
-	672769,
-	672772,
-	672784,
-	673024,
-	673793,
-	673793,
-	673793,
-	673808,
-	673808,
-	673808,
-	674048,
-	674048,
-	675841,
-	675841,
-	675841,
-	675856,
-	675856,
-	675968,
-	676096,
-	679937,
-	679937,
-	679937,
-	679937,
-	679940,
-	679940,
-	679952,
-	679952,
-	679952,
-	679952,
-	679952,
-	679968,
-	680000,
-	680064,
-	680064,
-	680192,
-	680192,
-	680192,
-	680192,
-	680960,
-	688145,
-	688145,
-	688145,
-	688145,
-	688145,
-	688145,
-	688145,
-	688145,
-	688145,
-	688148,
-	688148,
-	688257,
-	688385,
-	688385,
-	688385,
-	688385,
-	688392,
-	688400,
-	688400,
-	688400,
-	688400,
-	688400,
-	688448,
-	688512,
-	690432,
-	692225,
-	692240,
-	696576,
-	704513,
-	704513,
-	704513,
-	704520,
-	704528,
-	704528,
-	704528,
-	704528,
-	704528,
-	704528,
-	704528,
-	704528,
-	704528,
-	704640,
-	704768,
-	704768,
-	704768,
-	708608,
-	720913,
-	786451,
-	786451,
-	786451,
-	786451,
-	786451,
-	786451,
-	786451,
-	786451,
-	786451,
-	786453,
-	786453,
-	786453,
-	786453,
-	786453,
-	786457,
-	786457,
-	786457,
-	786457,
-	786457,
-	786457,
-	786458,
-	786460,
-	786469,
-	786481,
-	786481,
-	786481,
-	786481,
-	786481,
-	786513,
-	786513,
-	786513,
-	786513,
-	786563,
-	786563,
-	786565,
-	786565,
-	786569,
-	786569,
-	786577,
-	786577,
-	786577,
-	786577,
-	786577,
-	786577,
-	786578,
-	786580,
-	786580,
-	786593,
-	786593,
-	786608,
-	786625,
-	786625,
-	786640,
-	786691,
-	786691,
-	786691,
-	786691,
-	786691,
-	786693,
-	786697,
-	786697,
-	786697,
-	786697,
-	786705,
-	786705,
-	786706,
-	786706,
-	786706,
-	786706,
-	786706,
-	786708,
-	786708,
-	786712,
-	786712,
-	786712,
-	786712,
-	786712,
-	786712,
-	786712,
-	786712,
-	786712,
-	786721,
-	786721,
-	786721,
-	786736,
-	786736,
-	786736,
-	786753,
-	786753,
-	786753,
-	786753,
-	786768,
-	786784,
-	786817,
-	786817,
-	786817,
-	786817,
-	786820,
-	786820,
-	786820,
-	786820,
-	786820,
-	786824,
-	786832,
-	786832,
-	786848,
-	786880,
-	786961,
-	787461,
-	787461,
-	787473,
-	787473,
-	787473,
-	787473,
-	787473,
-	787473,
-	787473,
-	787480,
-	787585,
-	787713,
-	787713,
-	787716,
-	787716,
-	787728,
-	787728,
-	787728,
-	787728,
-	787728,
-	787744,
-	787840,
-	788483,
-	788483,
-	788485,
-	788485,
-	788485,
-	788485,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788497,
-	788498,
-	788498,
-	788498,
-	788500,
-	788513,
-	788528,
-	788528,
-	788560,
-	788609,
-	788609,
-	788609,
-	788609,
-	788737,
-	788737,
-	788737,
-	788737,
-	788737,
-	788737,
-	788738,
-	788738,
-	788752,
-	788752,
-	788752,
-	788752,
-	788752,
-	788752,
-	788752,
-	788768,
-	788768,
-	788800,
-	788800,
-	788864,
-	789248,
-	789505,
-	789505,
-	789520,
-	789760,
-	790545,
-	790545,
-	790545,
-	790545,
-	790545,
-	790545,
-	790545,
-	790545,
-	790593,
-	790657,
-	790672,
-	790672,
-	790785,
-	790785,
-	790792,
-	790800,
-	790800,
-	790800,
-	790800,
-	790800,
-	790800,
-	790800,
-	790816,
-	790912,
-	790912,
-	792577,
-	792577,
-	792592,
-	792592,
-	792832,
-	794629,
-	794629,
-	794629,
-	794629,
-	794633,
-	794633,
-	794641,
-	794641,
-	794641,
-	794641,
-	794641,
-	794641,
-	794642,
-	794644,
-	794644,
-	794644,
-	794648,
-	794648,
-	794648,
-	794689,
-	794689,
-	794689,
-	794689,
-	794689,
-	794704,
-	794704,
-	794753,
-	794753,
-	794753,
-	794753,
-	794768,
-	794768,
-	794768,
-	794881,
-	794881,
-	794881,
-	794881,
-	794881,
-	794881,
-	794882,
-	794888,
-	794888,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794896,
-	794912,
-	794944,
-	794944,
-	795008,
-	795008,
-	795008,
-	795649,
-	795649,
-	795904,
-	795904,
-	795904,
-	796673,
-	796688,
-	796928,
-	798976,
-	802819,
-	802819,
-	802819,
-	802819,
-	802819,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802821,
-	802825,
-	802825,
-	802825,
-	802833,
-	802833,
-	802834,
-	802834,
-	802836,
-	802836,
-	802836,
-	802836,
-	802836,
-	802840,
-	802840,
-	802840,
-	802849,
-	802849,
-	802881,
-	802881,
-	802881,
-	802896,
-	802945,
-	802945,
-	802945,
-	802945,
-	802945,
-	802948,
-	802960,
-	802960,
-	802960,
-	802960,
-	803008,
-	803008,
-	803073,
-	803073,
-	803073,
-	803073,
-	803073,
-	803074,
-	803074,
-	803076,
-	803076,
-	803076,
-	803080,
-	803080,
-	803088,
-	803088,
-	803104,
-	803200,
-	803329,
-	803329,
-	803584,
-	803844,
-	803856,
-	803856,
-	804096,
-	804865,
-	804865,
-	804865,
-	804865,
-	804865,
-	804866,
-	804866,
-	804868,
-	804868,
-	804872,
-	804872,
-	804880,
-	804880,
-	804880,
-	804880,
-	804896,
-	804896,
-	804928,
-	804992,
-	804992,
-	805120,
-	805120,
-	805376,
-	806913,
-	806913,
-	806913,
-	806913,
-	806913,
-	806914,
-	806928,
-	806928,
-	806928,
-	806928,
-	806928,
-	807040,
-	807168,
-	807168,
-	808960,
-	808960,
-	811009,
-	811012,
-	811016,
-	811024,
-	811024,
-	811024,
-	811024,
-	811024,
-	811024,
-	811024,
-	811040,
-	811072,
-	811072,
-	811264,
-	811264,
-	811264,
-	812032,
-	812032,
-	819205,
-	819217,
-	819217,
-	819217,
-	819217,
-	819217,
-	819217,
-	819217,
-	819220,
-	819329,
-	819329,
-	819329,
-	819457,
-	819457,
-	819457,
-	819457,
-	819457,
-	819457,
-	819472,
-	819472,
-	819472,
-	819472,
-	819472,
-	819472,
-	819584,
-	819584,
-	820240,
-	821249,
-	821249,
-	821249,
-	821264,
-	821264,
-	821264,
-	821264,
-	821504,
-	821504,
-	821504,
-	823297,
-	823297,
-	823312,
-	827393,
-	827408,
-	827648,
-	835585,
-	835585,
-	835600,
-	835600,
-	835600,
-	835600,
-	835600,
-	835600,
-	835712,
-	835712,
-	835840,
-	835840,
-	835840,
-	837632,
-	837632,
-	839680,
-	917507,
-	917507,
-	917507,
-	917509,
-	917509,
-	917509,
-	917513,
-	917513,
-	917513,
-	917513,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917521,
-	917522,
-	917524,
-	917528,
-	917537,
-	917537,
-	917537,
-	917552,
-	917569,
-	917584,
-	917633,
-	917633,
-	917633,
-	917633,
-	917761,
-	917761,
-	917761,
-	917761,
-	917761,
-	917761,
-	917761,
-	917761,
-	917761,
-	917762,
-	917762,
-	917764,
-	917768,
-	917768,
-	917768,
-	917776,
-	917776,
-	917776,
-	917776,
-	917776,
-	917776,
-	917776,
-	917776,
-	917776,
-	917792,
-	917792,
-	917792,
-	917792,
-	917824,
-	917824,
-	917824,
-	917824,
-	917824,
-	917888,
-	917888,
-	918529,
-	918529,
-	918529,
-	918529,
-	918544,
-	918544,
-	918784,
-	918784,
-	919553,
-	919808,
-	919808,
-	921601,
-	921601,
-	921601,
-	921601,
-	921616,
-	921616,
-	921856,
-	925697,
-	925697,
-	925697,
-	925697,
-	925712,
-	925712,
-	925712,
-	925712,
-	925712,
-	925952,
-	925952,
-	933889,
-	933889,
-	933889,
-	933889,
-	933889,
-	933889,
-	933890,
-	933892,
-	933892,
-	933896,
-	933904,
-	933904,
-	933904,
-	933904,
-	933904,
-	933904,
-	933904,
-	933904,
-	933920,
-	933920,
-	933920,
-	933952,
-	933952,
-	933952,
-	934016,
-	934016,
-	934144,
-	934144,
-	934144,
-	934144,
-	934144,
-	934144,
-	934144,
-	934912,
-	934912,
-	935936,
-	937984,
-	937984,
-	937984,
-	942080,
-	950273,
-	950273,
-	950273,
-	950273,
-	950273,
-	950273,
-	950273,
-	950288,
-	950288,
-	950288,
-	950528,
-	950528,
-	950528,
-	950528,
-	950528,
-	966656,
-	966656,
-	966656,
-	966656,
-	966656,
-	1048603,
-	1048606,
-	1048659,
-	1048666,
-	1048666,
-	1048689,
-	1048696,
-	1048711,
-	1048715,
-	1048730,
-	1048732,
-	1048741,
-	1048785,
-	1048801,
-	1048857,
-	1048860,
-	1048899,
-	1048901,
-	1048901,
-	1048901,
-	1048920,
-	1048920,
-	1048944,
-	1048965,
-	1048977,
-	1048996,
-	1048996,
-	1049099,
-	1049176,
-	1049225,
-	1049236,
-	1049364,
-	1049625,
-	1049733,
-	1049733,
-	1049861,
-	1049862,
-	1049892,
-	1049924,
-	1049985,
-	1049985,
-	1050121,
-	1050136,
-	1050631,
-	1050635,
-	1050637,
-	1050637,
-	1050649,
-	1050650,
-	1050652,
-	1050652,
-	1050665,
-	1050680,
-	1050697,
-	1050705,
-	1050705,
-	1050706,
-	1050706,
-	1050712,
-	1050721,
-	1050736,
-	1050736,
-	1050755,
-	1050761,
-	1050761,
-	1050769,
-	1050772,
-	1050785,
-	1050817,
-	1050820,
-	1050885,
-	1050885,
-	1050885,
-	1050889,
-	1050889,
-	1050890,
-	1050892,
-	1050920,
-	1050945,
-	1050952,
-	1050960,
-	1051024,
-	1051024,
-	1051139,
-	1051201,
-	1051393,
-	1051400,
-	1051408,
-	1051651,
-	1051651,
-	1051653,
-	1051665,
-	1051668,
-	1051696,
-	1051716,
-	1051728,
-	1051777,
-	1051777,
-	1052683,
-	1052691,
-	1052698,
-	1052728,
-	1052754,
-	1052760,
-	1052805,
-	1052865,
-	1052933,
-	1052937,
-	1052940,
-	1052946,
-	1052968,
-	1053060,
-	1053060,
-	1053064,
-	1053187,
-	1053189,
-	1053701,
-	1053705,
-	1053953,
-	1053954,
-	1054464,
-	1054723,
-	1054725,
-	1054729,
-	1054737,
-	1054737,
-	1054737,
-	1054737,
-	1054738,
-	1054738,
-	1054738,
-	1054744,
-	1054744,
-	1054768,
-	1054785,
-	1054785,
-	1054785,
-	1054785,
-	1054785,
-	1054800,
-	1054800,
-	1054849,
-	1054852,
-	1054977,
-	1054977,
-	1054978,
-	1054980,
-	1054992,
-	1055008,
-	1055040,
-	1055104,
-	1056775,
-	1056779,
-	1056781,
-	1056787,
-	1056789,
-	1056790,
-	1056793,
-	1056794,
-	1056796,
-	1056824,
-	1056835,
-	1056835,
-	1056835,
-	1056841,
-	1056849,
-	1056849,
-	1056849,
-	1056850,
-	1056856,
-	1056880,
-	1056901,
-	1056901,
-	1056902,
-	1056905,
-	1056906,
-	1056908,
-	1056964,
-	1057027,
-	1057027,
-	1057029,
-	1057034,
-	1057036,
-	1057042,
-	1057044,
-	1057044,
-	1057048,
-	1057048,
-	1057060,
-	1057064,
-	1057089,
-	1057092,
-	1057096,
-	1057096,
-	1057120,
-	1057120,
-	1057153,
-	1057160,
-	1057160,
-	1057160,
-	1057285,
-	1057289,
-	1057328,
-	1057345,
-	1057345,
-	1057600,
-	1057801,
-	1057816,
-	1057857,
-	1057924,
-	1057928,
-	1058049,
-	1058049,
-	1058050,
-	1058056,
-	1058112,
-	1058305,
-	1058819,
-	1058821,
-	1058821,
-	1058825,
-	1058825,
-	1058825,
-	1058825,
-	1058833,
-	1058833,
-	1058836,
-	1058840,
-	1058840,
-	1058849,
-	1058884,
-	1058896,
-	1058896,
-	1058912,
-	1058945,
-	1058948,
-	1059073,
-	1059073,
-	1059073,
-	1059080,
-	1059088,
-	1059104,
-	1059136,
-	1059136,
-	1059841,
-	1059841,
-	1059841,
-	1059842,
-	1059844,
-	1059872,
-	1060869,
-	1060873,
-	1060873,
-	1060873,
-	1060873,
-	1060873,
-	1060881,
-	1060897,
-	1060897,
-	1060929,
-	1060929,
-	1060944,
-	1060993,
-	1060993,
-	1060996,
-	1061121,
-	1061121,
-	1061121,
-	1061122,
-	1061124,
-	1061124,
-	1061124,
-	1061128,
-	1061136,
-	1061248,
-	1061377,
-	1061889,
-	1061889,
-	1062144,
-	1062913,
-	1062913,
-	1062928,
-	1063168,
-	1063168,
-	1064979,
-	1064988,
-	1064988,
-	1065029,
-	1065033,
-	1065042,
-	1065042,
-	1065044,
-	1065093,
-	1065094,
-	1065108,
-	1065154,
-	1065156,
-	1065160,
-	1065225,
-	1065226,
-	1065288,
-	1065312,
-	1065477,
-	1065664,
-	1065729,
-	1065730,
-	1065792,
-	1065990,
-	1066056,
-	1066113,
-	1066241,
-	1067013,
-	1067014,
-	1067017,
-	1067018,
-	1067020,
-	1067020,
-	1067026,
-	1067028,
-	1067032,
-	1067041,
-	1067080,
-	1067140,
-	1067144,
-	1067200,
-	1067200,
-	1067265,
-	1067268,
-	1067272,
-	1067280,
-	1067521,
-	1067536,
-	1067776,
-	1068544,
-	1069061,
-	1069065,
-	1069080,
-	1069122,
-	1069122,
-	1069186,
-	1069188,
-	1069248,
-	1069313,
-	1069320,
-	1069320,
-	1069376,
-	1069570,
-	1069572,
-	1070081,
-	1070082,
-	1070208,
-	1071108,
-	1071108,
-	1071112,
-	1071120,
-	1071120,
-	1071168,
-	1073155,
-	1073158,
-	1073162,
-	1073170,
-	1073172,
-	1073176,
-	1073192,
-	1073192,
-	1073217,
-	1073218,
-	1073218,
-	1073224,
-	1073224,
-	1073248,
-	1073288,
-	1073665,
-	1073668,
-	1074177,
-	1074178,
-	1074240,
-	1075208,
-	1075208,
-	1075264,
-	1075456,
-	1077249,
-	1077250,
-	1077256,
-	1077256,
-	1077312,
-	1077312,
-	1077504,
-	1081369,
-	1081432,
-	1081606,
-	1081610,
-	1081612,
-	1081612,
-	1082000,
-	1082373,
-	1082392,
-	1083395,
-	1083397,
-	1083401,
-	1083401,
-	1083412,
-	1083416,
-	1083416,
-	1083440,
-	1083472,
-	1083536,
-	1083584,
-	1083649,
-	1083652,
-	1083656,
-	1083712,
-	1083920,
-	1084417,
-	1084420,
-	1084672,
-	1085464,
-	1085464,
-	1085570,
-	1085572,
-	1085697,
-	1087489,
-	1087489,
-	1087490,
-	1087492,
-	1087504,
-	1087520,
-	1087552,
-	1087744,
-	1089541,
-	1089554,
-	1089556,
-	1089556,
-	1089560,
-	1089576,
-	1089601,
-	1089616,
-	1089665,
-	1089668,
-	1089796,
-	1089856,
-	1089920,
-	1090561,
-	1091585,
-	1091585,
-	1091840,
-	1092608,
-	1093648,
-	1097733,
-	1097733,
-	1097737,
-	1097748,
-	1097748,
-	1097860,
-	1097860,
-	1097872,
-	1099777,
-	1099780,
-	1099792,
-	1099792,
-	1099792,
-	1099792,
-	1100032,
-	1100800,
-	1102080,
-	1105928,
-	1106432,
-	1114133,
-	1114320,
-	1114373,
-	1114377,
-	1114385,
-	1114388,
-	1114392,
-	1114416,
-	1115141,
-	1115153,
-	1115153,
-	1115396,
-	1116177,
-	1116177,
-	1116177,
-	1116417,
-	1116417,
-	1118465,
-	1118465,
-	1120257,
-	1122321,
-	1122561,
-	1123584,
-	1126401,
-	1130505,
-	1130516,
-	1130516,
-	1134848,
-	1138944,
-	1146897,
-	1147152,
-	1147152,
-	1163520,
-	1179667,
-	1179669,
-	1179670,
-	1179670,
-	1179670,
-	1179673,
-	1179673,
-	1179674,
-	1179674,
-	1179674,
-	1179676,
-	1179676,
-	1179685,
-	1179689,
-	1179689,
-	1179697,
-	1179698,
-	1179704,
-	1179704,
-	1179715,
-	1179721,
-	1179729,
-	1179729,
-	1179729,
-	1179729,
-	1179730,
-	1179730,
-	1179730,
-	1179736,
-	1179736,
-	1179736,
-	1179779,
-	1179781,
-	1179796,
-	1179841,
-	1179842,
-	1179842,
-	1179856,
-	1179907,
-	1179909,
-	1179909,
-	1179910,
-	1179913,
-	1179921,
-	1179921,
-	1179924,
-	1179924,
-	1179928,
-	1179972,
-	1179972,
-	1180033,
-	1180033,
-	1180036,
-	1180163,
-	1180225,
-	1180240,
-	1180675,
-	1180689,
-	1180690,
-	1180690,
-	1180929,
-	1180930,
-	1181699,
-	1181705,
-	1181713,
-	1181713,
-	1181713,
-	1181714,
-	1181714,
-	1181714,
-	1181714,
-	1181716,
-	1181716,
-	1181716,
-	1181720,
-	1181720,
-	1181720,
-	1181720,
-	1181729,
-	1181729,
-	1181744,
-	1181744,
-	1181761,
-	1181761,
-	1181761,
-	1181776,
-	1181776,
-	1181776,
-	1181776,
-	1181825,
-	1181828,
-	1181828,
-	1181953,
-	1181953,
-	1181953,
-	1181960,
-	1181968,
-	1181984,
-	1182209,
-	1182209,
-	1182224,
-	1183747,
-	1183747,
-	1183747,
-	1183749,
-	1183749,
-	1183750,
-	1183753,
-	1183753,
-	1183762,
-	1183762,
-	1183762,
-	1183768,
-	1183768,
-	1183792,
-	1183792,
-	1183809,
-	1183809,
-	1183824,
-	1183874,
-	1183876,
-	1183888,
-	1184001,
-	1184008,
-	1184008,
-	1185024,
-	1185024,
-	1185793,
-	1185793,
-	1185793,
-	1185808,
-	1187843,
-	1187843,
-	1187843,
-	1187849,
-	1187857,
-	1187857,
-	1187858,
-	1187858,
-	1187864,
-	1187864,
-	1187864,
-	1187864,
-	1187864,
-	1187873,
-	1187873,
-	1187905,
-	1187912,
-	1187972,
-	1187972,
-	1187984,
-	1188097,
-	1188097,
-	1188098,
-	1188098,
-	1188098,
-	1188098,
-	1188100,
-	1188100,
-	1188100,
-	1188104,
-	1188104,
-	1188104,
-	1188112,
-	1188112,
-	1188160,
-	1188160,
-	1188160,
-	1188353,
-	1188865,
-	1188868,
-	1188872,
-	1189889,
-	1189889,
-	1189889,
-	1189920,
-	1190912,
-	1191937,
-	1191937,
-	1191937,
-	1191937,
-	1191937,
-	1191952,
-	1196035,
-	1196038,
-	1196041,
-	1196041,
-	1196042,
-	1196044,
-	1196056,
-	1196066,
-	1196097,
-	1196098,
-	1196104,
-	1196112,
-	1196112,
-	1196112,
-	1196112,
-	1196128,
-	1196224,
-	1196292,
-	1196296,
-	1196304,
-	1196352,
-	1196416,
-	1196546,
-	1197057,
-	1197064,
-	1197120,
-	1198081,
-	1198084,
-	1198088,
-	1198088,
-	1198112,
-	1198112,
-	1200129,
-	1200130,
-	1200132,
-	1200132,
-	1200136,
-	1200160,
-	1200256,
-	1200256,
-	1200640,
-	1202176,
-	1204225,
-	1204226,
-	1204226,
-	1204228,
-	1204232,
-	1204240,
-	1204352,
-	1204352,
-	1204736,
-	1205248,
-	1208320,
-	1212419,
-	1212425,
-	1212425,
-	1212433,
-	1212433,
-	1212433,
-	1212440,
-	1212440,
-	1212440,
-	1212440,
-	1212440,
-	1212481,
-	1212496,
-	1212545,
-	1212560,
-	1212673,
-	1212680,
-	1212688,
-	1213441,
-	1213456,
-	1214480,
-	1216513,
-	1216516,
-	1216528,
-	1216544,
-	1216576,
-	1216640,
-	1216768,
-	1220624,
-	1220624,
-	1220864,
-	1220864,
-	1228801,
-	1228804,
-	1228808,
-	1228864,
-	1232896,
-	1245201,
-	1245441,
-	1245456,
-	1246209,
-	1246464,
-	1247233,
-	1247248,
-	1247488,
-	1253392,
-	1261584,
-	1310727,
-	1310727,
-	1310731,
-	1310731,
-	1310733,
-	1310733,
-	1310739,
-	1310739,
-	1310741,
-	1310741,
-	1310742,
-	1310742,
-	1310745,
-	1310746,
-	1310746,
-	1310748,
-	1310748,
-	1310762,
-	1310769,
-	1310776,
-	1310776,
-	1310793,
-	1310793,
-	1310801,
-	1310801,
-	1310808,
-	1310817,
-	1310851,
-	1310851,
-	1310851,
-	1310851,
-	1310853,
-	1310853,
-	1310854,
-	1310854,
-	1310857,
-	1310865,
-	1310868,
-	1310872,
-	1310913,
-	1310913,
-	1310916,
-	1310928,
-	1310985,
-	1310985,
-	1310988,
-	1310988,
-	1310996,
-	1311009,
-	1311012,
-	1311012,
-	1311041,
-	1311042,
-	1311048,
-	1311056,
-	1311106,
-	1311108,
-	1311112,
-	1311168,
-	1311235,
-	1311241,
-	1311250,
-	1311250,
-	1311256,
-	1311376,
-	1311504,
-	1311520,
-	1311750,
-	1311753,
-	1311756,
-	1311761,
-	1311764,
-	1311768,
-	1311780,
-	1311809,
-	1311812,
-	1311873,
-	1311873,
-	1311873,
-	1311876,
-	1311876,
-	1312257,
-	1312272,
-	1312771,
-	1312773,
-	1312773,
-	1312773,
-	1312774,
-	1312777,
-	1312777,
-	1312777,
-	1312777,
-	1312777,
-	1312785,
-	1312785,
-	1312786,
-	1312786,
-	1312786,
-	1312788,
-	1312788,
-	1312792,
-	1312792,
-	1312792,
-	1312792,
-	1312801,
-	1312801,
-	1312802,
-	1312816,
-	1312816,
-	1312816,
-	1312833,
-	1312833,
-	1312833,
-	1312848,
-	1312848,
-	1312848,
-	1312848,
-	1312864,
-	1312897,
-	1312897,
-	1312897,
-	1312898,
-	1312898,
-	1312900,
-	1312928,
-	1313025,
-	1313025,
-	1313028,
-	1313040,
-	1313040,
-	1313056,
-	1313088,
-	1313088,
-	1313088,
-	1313152,
-	1313296,
-	1313793,
-	1313793,
-	1313793,
-	1313794,
-	1313796,
-	1313796,
-	1313824,
-	1313920,
-	1314821,
-	1314821,
-	1314821,
-	1314821,
-	1314825,
-	1314825,
-	1314826,
-	1314833,
-	1314833,
-	1314834,
-	1314834,
-	1314840,
-	1314840,
-	1314850,
-	1314864,
-	1314881,
-	1314881,
-	1314881,
-	1314896,
-	1314945,
-	1314945,
-	1314948,
-	1314960,
-	1315073,
-	1315076,
-	1315076,
-	1315088,
-	1315088,
-	1315841,
-	1315841,
-	1315844,
-	1316096,
-	1316865,
-	1316865,
-	1316865,
-	1316865,
-	1316865,
-	1316865,
-	1316868,
-	1316880,
-	1316880,
-	1316880,
-	1317120,
-	1318915,
-	1318917,
-	1318921,
-	1318921,
-	1318922,
-	1318929,
-	1318936,
-	1318936,
-	1318945,
-	1318945,
-	1318952,
-	1318977,
-	1318977,
-	1318977,
-	1318977,
-	1318977,
-	1318978,
-	1318984,
-	1318992,
-	1318992,
-	1319041,
-	1319056,
-	1319169,
-	1319169,
-	1319169,
-	1319169,
-	1319172,
-	1319172,
-	1319176,
-	1319176,
-	1319176,
-	1319184,
-	1319184,
-	1319184,
-	1319200,
-	1319232,
-	1319232,
-	1319425,
-	1319425,
-	1319937,
-	1319937,
-	1319938,
-	1319940,
-	1319944,
-	1319952,
-	1319968,
-	1320000,
-	1320064,
-	1320448,
-	1320961,
-	1320961,
-	1320961,
-	1320961,
-	1320976,
-	1321024,
-	1321024,
-	1321088,
-	1321216,
-	1321216,
-	1321984,
-	1321984,
-	1323009,
-	1323010,
-	1323024,
-	1323024,
-	1323024,
-	1323264,
-	1323264,
-	1323264,
-	1327110,
-	1327116,
-	1327122,
-	1327124,
-	1327128,
-	1327140,
-	1327170,
-	1327184,
-	1327200,
-	1327236,
-	1327236,
-	1327248,
-	1327296,
-	1327361,
-	1327368,
-	1327617,
-	1327624,
-	1327680,
-	1328130,
-	1328132,
-	1328136,
-	1328640,
-	1329153,
-	1329154,
-	1329154,
-	1329156,
-	1329160,
-	1329168,
-	1329168,
-	1329168,
-	1329168,
-	1329184,
-	1329184,
-	1329408,
-	1331202,
-	1331204,
-	1331208,
-	1331208,
-	1331216,
-	1331216,
-	1331264,
-	1331456,
-	1333248,
-	1333248,
-	1333248,
-	1335297,
-	1335298,
-	1335298,
-	1335300,
-	1335300,
-	1335304,
-	1335304,
-	1335304,
-	1339392,
-	1343493,
-	1343497,
-	1343505,
-	1343506,
-	1343508,
-	1343512,
-	1343512,
-	1343512,
-	1343553,
-	1343617,
-	1343745,
-	1343746,
-	1343748,
-	1343752,
-	1343872,
-	1344001,
-	1344016,
-	1344516,
-	1344528,
-	1344528,
-	1345537,
-	1345537,
-	1345537,
-	1345540,
-	1345552,
-	1345552,
-	1345552,
-	1345600,
-	1345600,
-	1345664,
-	1345792,
-	1345792,
-	1345792,
-	1346560,
-	1347585,
-	1347586,
-	1347592,
-	1347592,
-	1347600,
-	1347712,
-	1347712,
-	1347840,
-	1348096,
-	1349632,
-	1349632,
-	1349632,
-	1351681,
-	1351681,
-	1351744,
-	1351744,
-	1351936,
-	1352704,
-	1352704,
-	1355776,
-	1359876,
-	1359876,
-	1359876,
-	1359876,
-	1359880,
-	1359904,
-	1360000,
-	1360128,
-	1361920,
-	1363968,
-	1376259,
-	1376265,
-	1376265,
-	1376273,
-	1376321,
-	1376336,
-	1376385,
-	1376513,
-	1376513,
-	1376514,
-	1376520,
-	1376520,
-	1380353,
-	1384704,
-	1384704,
-	1392648,
-	1409280,
-	1441795,
-	1441795,
-	1441795,
-	1441795,
-	1441797,
-	1441797,
-	1441797,
-	1441797,
-	1441798,
-	1441798,
-	1441801,
-	1441801,
-	1441801,
-	1441802,
-	1441802,
-	1441804,
-	1441804,
-	1441809,
-	1441809,
-	1441809,
-	1441809,
-	1441809,
-	1441810,
-	1441810,
-	1441810,
-	1441810,
-	1441812,
-	1441812,
-	1441812,
-	1441812,
-	1441812,
-	1441816,
-	1441816,
-	1441816,
-	1441825,
-	1441828,
-	1441828,
-	1441828,
-	1441857,
-	1441857,
-	1441857,
-	1441857,
-	1441858,
-	1441858,
-	1441864,
-	1441872,
-	1441872,
-	1441872,
-	1441872,
-	1441888,
-	1441921,
-	1441921,
-	1441922,
-	1441922,
-	1441922,
-	1441924,
-	1441928,
-	1441936,
-	1441936,
-	1441952,
-	1441952,
-	1441984,
-	1441984,
-	1441984,
-	1442049,
-	1442049,
-	1442049,
-	1442056,
-	1442064,
-	1442112,
-	1442560,
-	1442817,
-	1442818,
-	1442820,
-	1443841,
-	1443841,
-	1443841,
-	1443842,
-	1443842,
-	1443842,
-	1443844,
-	1443856,
-	1443856,
-	1443856,
-	1443856,
-	1443872,
-	1443968,
-	1444864,
-	1445889,
-	1445889,
-	1445889,
-	1445889,
-	1445889,
-	1445889,
-	1445889,
-	1445892,
-	1445896,
-	1445904,
-	1445904,
-	1445904,
-	1445904,
-	1446912,
-	1449986,
-	1449988,
-	1449992,
-	1450000,
-	1450000,
-	1450000,
-	1450048,
-	1450240,
-	1450240,
-	1451008,
-	1452032,
-	1452032,
-	1458180,
-	1458180,
-	1458184,
-	1458184,
-	1458184,
-	1458192,
-	1458192,
-	1458192,
-	1458208,
-	1458304,
-	1458432,
-	1458688,
-	1460224,
-	1460224,
-	1462272,
-	1462272,
-	1466368,
-	1474561,
-	1474561,
-	1474561,
-	1474562,
-	1474576,
-	1474576,
-	1474576,
-	1474576,
-	1474624,
-	1474816,
-	1474816,
-	1474816,
-	1476608,
-	1476608,
-	1476608,
-	1478656,
-	1482752,
-	1482752,
-	1490944,
-	1490944,
-	1490944,
-	1507456,
-	1507584,
-	1572877,
-	1572883,
-	1572883,
-	1572883,
-	1572883,
-	1572885,
-	1572886,
-	1572890,
-	1572890,
-	1572892,
-	1572913,
-	1572931,
-	1572945,
-	1572945,
-	1572945,
-	1572946,
-	1572995,
-	1572997,
-	1572998,
-	1573001,
-	1573004,
-	1573009,
-	1573012,
-	1573012,
-	1573012,
-	1573057,
-	1573057,
-	1573058,
-	1573072,
-	1573125,
-	1573126,
-	1573126,
-	1573126,
-	1573129,
-	1573140,
-	1573140,
-	1573185,
-	1573186,
-	1573216,
-	1573249,
-	1573256,
-	1573505,
-	1573636,
-	1573664,
-	1573891,
-	1574020,
-	1574146,
-	1574148,
-	1574401,
-	1574915,
-	1574915,
-	1574917,
-	1574921,
-	1574921,
-	1574921,
-	1574929,
-	1574929,
-	1574929,
-	1574930,
-	1574930,
-	1574932,
-	1574932,
-	1574936,
-	1574936,
-	1574945,
-	1574960,
-	1574977,
-	1574977,
-	1575041,
-	1575056,
-	1575072,
-	1575169,
-	1575170,
-	1575172,
-	1575172,
-	1575184,
-	1575184,
-	1575184,
-	1575232,
-	1575937,
-	1575952,
-	1576969,
-	1576977,
-	1576978,
-	1576980,
-	1576984,
-	1577008,
-	1577025,
-	1577090,
-	1577092,
-	1577104,
-	1577217,
-	1577220,
-	1577224,
-	1577248,
-	1577344,
-	1578240,
-	1579009,
-	1579009,
-	1579012,
-	1579024,
-	1579264,
-	1579264,
-	1581059,
-	1581061,
-	1581061,
-	1581065,
-	1581065,
-	1581066,
-	1581073,
-	1581074,
-	1581080,
-	1581080,
-	1581089,
-	1581121,
-	1581121,
-	1581136,
-	1581136,
-	1581185,
-	1581185,
-	1581185,
-	1581185,
-	1581192,
-	1581248,
-	1581313,
-	1581313,
-	1581314,
-	1581314,
-	1581316,
-	1581316,
-	1581316,
-	1581316,
-	1581328,
-	1581328,
-	1581328,
-	1581344,
-	1581440,
-	1581569,
-	1581569,
-	1581569,
-	1582081,
-	1582081,
-	1582096,
-	1582096,
-	1582208,
-	1583105,
-	1583105,
-	1583106,
-	1583120,
-	1583120,
-	1583360,
-	1583360,
-	1585153,
-	1585168,
-	1589251,
-	1589258,
-	1589265,
-	1589266,
-	1589266,
-	1589272,
-	1589296,
-	1589313,
-	1589328,
-	1589380,
-	1589380,
-	1589380,
-	1589380,
-	1589408,
-	1589440,
-	1589440,
-	1589536,
-	1590288,
-	1591297,
-	1591297,
-	1591298,
-	1591298,
-	1591300,
-	1591300,
-	1591304,
-	1591312,
-	1591328,
-	1591360,
-	1591424,
-	1593472,
-	1593600,
-	1595392,
-	1595392,
-	1597442,
-	1597444,
-	1597448,
-	1597456,
-	1597472,
-	1597504,
-	1597504,
-	1597568,
-	1597952,
-	1598464,
-	1601536,
-	1601536,
-	1601536,
-	1605637,
-	1605649,
-	1605649,
-	1605712,
-	1605712,
-	1605712,
-	1605889,
-	1605896,
-	1605904,
-	1605904,
-	1606160,
-	1606657,
-	1606672,
-	1606912,
-	1607681,
-	1607696,
-	1607696,
-	1607936,
-	1607936,
-	1609744,
-	1609856,
-	1609984,
-	1613825,
-	1613825,
-	1613825,
-	1613828,
-	1614080,
-	1614080,
-	1614848,
-	1622017,
-	1622017,
-	1622017,
-	1624064,
-	1624064,
-	1624064,
-	1630208,
-	1630208,
-	1630208,
-	1630208,
-	1638417,
-	1638672,
-	1638672,
-	1640464,
-	1640704,
-	1646593,
-	1646608,
-	1646848,
-	1654785,
-	1654800,
-	1654800,
-	1654912,
-	1655040,
-	1655040,
-	1703939,
-	1703939,
-	1703939,
-	1703941,
-	1703941,
-	1703945,
-	1703953,
-	1703953,
-	1703954,
-	1703954,
-	1703954,
-	1703954,
-	1703954,
-	1703956,
-	1703956,
-	1703956,
-	1703956,
-	1703956,
-	1703956,
-	1703960,
-	1703960,
-	1703960,
-	1704032,
-	1704068,
-	1704068,
-	1704080,
-	1704080,
-	1704193,
-	1704194,
-	1704196,
-	1704208,
-	1704208,
-	1704224,
-	1704449,
-	1704961,
-	1704961,
-	1704961,
-	1704964,
-	1705216,
-	1705216,
-	1705985,
-	1705985,
-	1705986,
-	1706000,
-	1706016,
-	1706112,
-	1706112,
-	1708033,
-	1708033,
-	1708033,
-	1708048,
-	1708160,
-	1708160,
-	1712129,
-	1712129,
-	1712129,
-	1712130,
-	1712130,
-	1712132,
-	1712136,
-	1712144,
-	1712144,
-	1712144,
-	1712192,
-	1712384,
-	1713152,
-	1720321,
-	1720321,
-	1720321,
-	1720322,
-	1720324,
-	1720324,
-	1720324,
-	1720328,
-	1720336,
-	1720336,
-	1720336,
-	1720336,
-	1720336,
-	1720384,
-	1720448,
-	1720448,
-	1720576,
-	1724416,
-	1728512,
-	1736705,
-	1736720,
-	1740800,
-	1744896,
-	1769473,
-	1769728,
-	1769728,
-	1835011,
-	1835011,
-	1835011,
-	1835011,
-	1835013,
-	1835013,
-	1835013,
-	1835017,
-	1835017,
-	1835020,
-	1835025,
-	1835026,
-	1835026,
-	1835026,
-	1835028,
-	1835028,
-	1835028,
-	1835032,
-	1835032,
-	1835041,
-	1835041,
-	1835044,
-	1835056,
-	1835073,
-	1835073,
-	1835073,
-	1835073,
-	1835088,
-	1835137,
-	1835138,
-	1835144,
-	1835152,
-	1835168,
-	1835200,
-	1835266,
-	1835266,
-	1835268,
-	1835268,
-	1835272,
-	1835280,
-	1835280,
-	1835328,
-	1835536,
-	1835552,
-	1836033,
-	1836036,
-	1836036,
-	1836288,
-	1837057,
-	1837057,
-	1837057,
-	1837057,
-	1837057,
-	1837060,
-	1837060,
-	1837072,
-	1837072,
-	1837120,
-	1837312,
-	1837312,
-	1837312,
-	1839105,
-	1839105,
-	1839105,
-	1839105,
-	1839120,
-	1839120,
-	1839120,
-	1839120,
-	1839120,
-	1839232,
-	1839360,
-	1839360,
-	1839360,
-	1839360,
-	1841152,
-	1843201,
-	1843201,
-	1843201,
-	1843201,
-	1843201,
-	1843201,
-	1843201,
-	1843202,
-	1843204,
-	1843208,
-	1843208,
-	1843216,
-	1843216,
-	1843216,
-	1843216,
-	1843264,
-	1843264,
-	1843328,
-	1843328,
-	1843456,
-	1843456,
-	1843456,
-	1843456,
-	1843456,
-	1843456,
-	1844224,
-	1845248,
-	1851393,
-	1851393,
-	1851393,
-	1851394,
-	1851394,
-	1851394,
-	1851396,
-	1851400,
-	1851408,
-	1851424,
-	1851456,
-	1851456,
-	1851520,
-	1851520,
-	1851520,
-	1851904,
-	1851904,
-	1852416,
-	1853440,
-	1853440,
-	1853440,
-	1855488,
-	1859584,
-	1859584,
-	1859584,
-	1859584,
-	1867777,
-	1867777,
-	1867777,
-	1867792,
-	1867792,
-	1867792,
-	1867792,
-	1868032,
-	1868032,
-	1868032,
-	1871872,
-	1871872,
-	1871872,
-	1875968,
-	1884160,
-	1884160,
-	1884160,
-	1884160,
-	1900545,
-	1900560,
-	1900560,
-	1900800,
-	1900800,
-	1900800,
-	1966081,
-	1966081,
-	1966081,
-	1966081,
-	1966082,
-	1966082,
-	1966084,
-	1966084,
-	1966088,
-	1966088,
-	1966096,
-	1966096,
-	1966096,
-	1966096,
-	1966096,
-	1966112,
-	1966112,
-	1966144,
-	1966208,
-	1966208,
-	1966208,
-	1966208,
-	1966336,
-	1966336,
-	1966336,
-	1967104,
-	1967104,
-	1970176,
-	1974272,
-	1974272,
-	1974272,
-	1982464,
-	1982464,
-	1982464,
-	1982464,
-	1982464,
-	1982464,
-	1982464,
-	1998848,
-	1998848,
-	2097181,
-	2097299,
-	2097301,
-	2097301,
-	2097429,
-	2097436,
-	2097436,
-	2097449,
-	2097489,
-	2097556,
-	2097560,
-	2097689,
-	2097809,
-	2097944,
-	2098437,
-	2099221,
-	2099221,
-	2099221,
-	2099225,
-	2099225,
-	2099249,
-	2099281,
-	2099281,
-	2099333,
-	2099345,
-	2099345,
-	2099461,
-	2099461,
-	2099461,
-	2099465,
-	2099473,
-	2099473,
-	2099474,
-	2099476,
-	2099476,
-	2099480,
-	2099480,
-	2099480,
-	2099729,
-	2100481,
-	2100496,
-	2101513,
-	2101521,
-	2105365,
-	2105369,
-	2105369,
-	2105425,
-	2105425,
-	2105425,
-	2105489,
-	2105603,
-	2105605,
-	2105605,
-	2105609,
-	2105609,
-	2105617,
-	2105617,
-	2105617,
-	2105617,
-	2105620,
-	2105624,
-	2105665,
-	2105680,
-	2105873,
-	2106385,
-	2106385,
-	2106640,
-	2106640,
-	2107409,
-	2107409,
-	2107409,
-	2107649,
-	2107649,
-	2107649,
-	2107649,
-	2107664,
-	2107664,
-	2109457,
-	2109697,
-	2109712,
-	2113543,
-	2113555,
-	2113564,
-	2113585,
-	2113617,
-	2113669,
-	2113801,
-	2113802,
-	2113804,
-	2113812,
-	2113816,
-	2113872,
-	2113872,
-	2114305,
-	2114569,
-	2114577,
-	2115589,
-	2115594,
-	2115601,
-	2115601,
-	2115604,
-	2115608,
-	2115608,
-	2115617,
-	2115649,
-	2115649,
-	2115664,
-	2115728,
-	2115841,
-	2115841,
-	2115841,
-	2115856,
-	2115856,
-	2115856,
-	2116864,
-	2117641,
-	2117649,
-	2117656,
-	2117904,
-	2119936,
-	2121731,
-	2121745,
-	2121748,
-	2121752,
-	2121752,
-	2121764,
-	2121796,
-	2121872,
-	2121985,
-	2121988,
-	2121988,
-	2121992,
-	2122000,
-	2122000,
-	2123792,
-	2125840,
-	2125840,
-	2129945,
-	2130185,
-	2130185,
-	2134273,
-	2138129,
-	2138369,
-	2228243,
-	2228243,
-	2228245,
-	2228245,
-	2228245,
-	2228245,
-	2228249,
-	2228249,
-	2228249,
-	2228305,
-	2228369,
-	2228483,
-	2228485,
-	2228485,
-	2228497,
-	2228497,
-	2228498,
-	2228504,
-	2228504,
-	2228504,
-	2228504,
-	2228504,
-	2228528,
-	2228545,
-	2228560,
-	2228560,
-	2228560,
-	2228624,
-	2228753,
-	2228993,
-	2229265,
-	2229520,
-	2229520,
-	2230289,
-	2230289,
-	2230289,
-	2230289,
-	2230289,
-	2230529,
-	2230529,
-	2230544,
-	2230544,
-	2230544,
-	2230544,
-	2230544,
-	2230544,
-	2236433,
-	2236433,
-	2236673,
-	2236673,
-	2236673,
-	2236688,
-	2236688,
-	2244611,
-	2244613,
-	2244626,
-	2244628,
-	2244628,
-	2244632,
-	2244632,
-	2244632,
-	2244632,
-	2244632,
-	2244641,
-	2244688,
-	2244752,
-	2244865,
-	2244865,
-	2244880,
-	2244928,
-	2244928,
-	2246657,
-	2246657,
-	2246672,
-	2246912,
-	2248712,
-	2248720,
-	2248720,
-	2252816,
-	2253056,
-	2261009,
-	2261009,
-	2261009,
-	2261264,
-	2277377,
-	2277392,
-	2359317,
-	2359321,
-	2359321,
-	2359377,
-	2359429,
-	2359441,
-	2359441,
-	2359441,
-	2359561,
-	2359561,
-	2359561,
-	2359569,
-	2359570,
-	2359572,
-	2359576,
-	2359576,
-	2359600,
-	2359617,
-	2359632,
-	2359681,
-	2359696,
-	2359696,
-	2360080,
-	2360577,
-	2360592,
-	2361349,
-	2361361,
-	2361361,
-	2361361,
-	2361361,
-	2361361,
-	2361361,
-	2361361,
-	2361368,
-	2361601,
-	2361601,
-	2361601,
-	2361601,
-	2361616,
-	2361616,
-	2361616,
-	2361616,
-	2361616,
-	2361616,
-	2363649,
-	2363649,
-	2367505,
-	2367505,
-	2367505,
-	2367505,
-	2367512,
-	2367553,
-	2367745,
-	2367745,
-	2367745,
-	2367745,
-	2367760,
-	2367760,
-	2367760,
-	2375697,
-	2375697,
-	2375700,
-	2375700,
-	2375700,
-	2375704,
-	2375824,
-	2375937,
-	2375938,
-	2375944,
-	2377729,
-	2377729,
-	2377744,
-	2377744,
-	2377744,
-	2377984,
-	2379777,
-	2379792,
-	2380032,
-	2383873,
-	2383888,
-	2384128,
-	2384128,
-	2392081,
-	2392081,
-	2392081,
-	2392193,
-	2392321,
-	2396161,
-	2490385,
-	2490385,
-	2490385,
-	2490385,
-	2490386,
-	2490625,
-	2490640,
-	2490640,
-	2490640,
-	2490640,
-	2492672,
-	2494720,
-	2506753,
-	2506753,
-	2506753,
-	2506768,
-	2506768,
-	2506768,
-	2506768,
-	2507008,
-	2621585,
-	2621588,
-	2621701,
-	2621705,
-	2621713,
-	2621716,
-	2621716,
-	2621720,
-	2622593,
-	2623505,
-	2623512,
-	2623745,
-	2629649,
-	2629649,
-	2629649,
-	2629889,
-	2629904,
-	2629952,
-	2630912,
-	2637829,
-	2637841,
-	2637844,
-	2637848,
-	2637848,
-	2637889,
-	2637953,
-	2638088,
-	2639873,
-	2639873,
-	2639873,
-	2639888,
-	2639888,
-	2640128,
-	2642176,
-	2646017,
-	2670848,
-	2752529,
-	2752529,
-	2752529,
-	2752529,
-	2752769,
-	2752784,
-	2752784,
-	2752784,
-	2768897,
-	2768912,
-	2768912,
-	2768912,
-	2768912,
-	2768912,
-	2768912,
-	2769152,
-	2883601,
-	2883601,
-	2883601,
-	2883841,
-	2883856,
-	2885648,
-	2891792,
-	2892032,
-	2899984,
-	2899984,
-	2899984,
-	2900224,
-	2900224,
-	2902016,
-	3014672,
-	3014672,
-	3145749,
-	3145777,
-	3145809,
-	3145873,
-	3145989,
-	3145993,
-	3146056,
-	3146497,
-	3147793,
-	3147793,
-	3149829,
-	3149841,
-	3149841,
-	3151888,
-	3155969,
-	3158272,
-	3162117,
-	3162129,
-	3162132,
-	3162192,
-	3162192,
-	3162244,
-	3162256,
-	3164161,
-	3164176,
-	3164224,
-	3164224,
-	3164416,
-	3164416,
-	3166212,
-	3166216,
-	3170312,
-	3174400,
-	3211281,
-	3211536,
-	3276820,
-	3277064,
-	3278080,
-	3280897,
-	3280912,
-	3293185,
-	3293200,
-	3407877,
-	3407889,
-	3407889,
-	3407889,
-	3407905,
-	3407937,
-	3408064,
-	3408132,
-	3408136,
-	3408144,
-	3409921,
-	3409921,
-	3411984,
-	3416080,
-	3416080,
-	3432448,
-	3538945,
-	3538960,
-	3538960,
-	3539200,
-	3571712,
-	3670033,
-	3670040,
-	3672065,
-	3678209,
-	3686656,
-	3801104,
-	3801216,
-	3801344,
-	3817472,
-	3932176,
-	3948544,
-	4063232,
-	4194333,
-	4194333,
-	4194393,
-	4194393,
-	4194457,
-	4194585,
-	4194616,
-	4194642,
-	4194691,
-	4194768,
-	4194841,
-	4195347,
-	4195349,
-	4195353,
-	4195461,
-	4195461,
-	4195617,
-	4195713,
-	4195716,
-	4195728,
-	4196377,
-	4196377,
-	4196377,
-	4196377,
-	4196377,
-	4196377,
-	4196485,
-	4196497,
-	4196497,
-	4196497,
-	4196500,
-	4196632,
-	4196632,
-	4196673,
-	4196752,
-	4197381,
-	4197393,
-	4197520,
-	4197760,
-	4198425,
-	4198545,
-	4198545,
-	4200457,
-	4200465,
-	4200577,
-	4200592,
-	4202521,
-	4202521,
-	4202521,
-	4202521,
-	4202545,
-	4202569,
-	4202629,
-	4202633,
-	4202644,
-	4202689,
-	4202761,
-	4202772,
-	4202776,
-	4202776,
-	4202776,
-	4202776,
-	4202776,
-	4202776,
-	4202800,
-	4202817,
-	4202817,
-	4202817,
-	4202832,
-	4202832,
-	4202884,
-	4202896,
-	4202896,
-	4202944,
-	4203537,
-	4203649,
-	4203777,
-	4204547,
-	4204561,
-	4204561,
-	4204577,
-	4204801,
-	4204801,
-	4206864,
-	4210714,
-	4210716,
-	4210770,
-	4210776,
-	4210821,
-	4210833,
-	4210962,
-	4210962,
-	4210968,
-	4211224,
-	4211729,
-	4211841,
-	4211844,
-	4211969,
-	4212739,
-	4212739,
-	4212739,
-	4212741,
-	4212745,
-	4212753,
-	4212754,
-	4212754,
-	4212754,
-	4212754,
-	4212756,
-	4212760,
-	4212760,
-	4212769,
-	4212784,
-	4212801,
-	4212880,
-	4212880,
-	4212996,
-	4213264,
-	4213761,
-	4213792,
-	4214802,
-	4214808,
-	4214913,
-	4214913,
-	4214916,
-	4215041,
-	4215056,
-	4218883,
-	4218885,
-	4218889,
-	4218898,
-	4218904,
-	4218904,
-	4218904,
-	4218904,
-	4218945,
-	4218945,
-	4218945,
-	4219012,
-	4219024,
-	4219137,
-	4219138,
-	4219144,
-	4219200,
-	4219905,
-	4219905,
-	4219920,
-	4219920,
-	4220929,
-	4220930,
-	4220932,
-	4220944,
-	4220960,
-	4222977,
-	4222992,
-	4222992,
-	4223232,
-	4227091,
-	4227097,
-	4227352,
-	4229137,
-	4229249,
-	4229264,
-	4229377,
-	4231297,
-	4247680,
-	4251649,
-	4325395,
-	4325401,
-	4325401,
-	4325401,
-	4325417,
-	4325425,
-	4325457,
-	4325509,
-	4325521,
-	4325521,
-	4325537,
-	4325641,
-	4325656,
-	4325656,
-	4325656,
-	4325656,
-	4325656,
-	4325656,
-	4325761,
-	4326405,
-	4326409,
-	4326417,
-	4326417,
-	4326420,
-	4326660,
-	4327427,
-	4327429,
-	4327433,
-	4327441,
-	4327441,
-	4327553,
-	4327808,
-	4329477,
-	4333571,
-	4333577,
-	4333585,
-	4333585,
-	4333585,
-	4333601,
-	4333633,
-	4333825,
-	4333840,
-	4333840,
-	4333840,
-	4333888,
-	4341770,
-	4341772,
-	4341778,
-	4341780,
-	4341784,
-	4341784,
-	4341904,
-	4342273,
-	4342288,
-	4342785,
-	4342785,
-	4342800,
-	4343812,
-	4343816,
-	4343824,
-	4343824,
-	4343824,
-	4343840,
-	4343872,
-	4343936,
-	4345857,
-	4345872,
-	4349953,
-	4349954,
-	4349956,
-	4349960,
-	4349968,
-	4349968,
-	4349968,
-	4349968,
-	4349984,
-	4350016,
-	4350016,
-	4358161,
-	4358273,
-	4358416,
-	4362241,
-	4366337,
-	4374544,
-	4376576,
-	4456459,
-	4456461,
-	4456473,
-	4456473,
-	4456529,
-	4456529,
-	4456581,
-	4456581,
-	4456581,
-	4456593,
-	4456593,
-	4456593,
-	4456596,
-	4456713,
-	4456721,
-	4456728,
-	4456728,
-	4456737,
-	4456752,
-	4456833,
-	4456840,
-	4456896,
-	4457232,
-	4457477,
-	4457477,
-	4457481,
-	4457489,
-	4457489,
-	4457489,
-	4457537,
-	4457601,
-	4457729,
-	4457732,
-	4457732,
-	4457856,
-	4458499,
-	4458499,
-	4458501,
-	4458501,
-	4458501,
-	4458513,
-	4458513,
-	4458513,
-	4458513,
-	4458513,
-	4458516,
-	4458520,
-	4458529,
-	4458544,
-	4458625,
-	4458625,
-	4458640,
-	4458640,
-	4458753,
-	4458753,
-	4458760,
-	4458768,
-	4458768,
-	4458768,
-	4458880,
-	4459521,
-	4459521,
-	4459536,
-	4460561,
-	4460673,
-	4460673,
-	4460801,
-	4460801,
-	4460816,
-	4460928,
-	4461569,
-	4462608,
-	4464649,
-	4464649,
-	4464657,
-	4464657,
-	4464657,
-	4464664,
-	4464673,
-	4464705,
-	4464705,
-	4464769,
-	4464784,
-	4464784,
-	4464897,
-	4464897,
-	4464897,
-	4464904,
-	4464912,
-	4464912,
-	4464912,
-	4464912,
-	4464912,
-	4464960,
-	4464960,
-	4465024,
-	4465665,
-	4465920,
-	4465920,
-	4466689,
-	4472837,
-	4472837,
-	4472841,
-	4472850,
-	4472856,
-	4472856,
-	4472904,
-	4472912,
-	4472961,
-	4472964,
-	4472968,
-	4472968,
-	4472976,
-	4472976,
-	4472992,
-	4473857,
-	4473920,
-	4473984,
-	4474881,
-	4474882,
-	4474882,
-	4474884,
-	4474884,
-	4474888,
-	4474896,
-	4474896,
-	4474896,
-	4474896,
-	4474912,
-	4474912,
-	4474912,
-	4474944,
-	4475008,
-	4475392,
-	4476930,
-	4476944,
-	4476944,
-	4481025,
-	4481032,
-	4481040,
-	4481040,
-	4481088,
-	4481152,
-	4481280,
-	4482048,
-	4482048,
-	4482048,
-	4483072,
-	4483072,
-	4489233,
-	4489345,
-	4489345,
-	4489488,
-	4489488,
-	4489600,
-	4489600,
-	4491265,
-	4491265,
-	4491280,
-	4493313,
-	4497409,
-	4497409,
-	4505728,
-	4507648,
-	4524048,
-	4587523,
-	4587525,
-	4587525,
-	4587529,
-	4587529,
-	4587529,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587537,
-	4587538,
-	4587540,
-	4587540,
-	4587544,
-	4587553,
-	4587664,
-	4587664,
-	4587777,
-	4587777,
-	4587784,
-	4587792,
-	4587792,
-	4587792,
-	4587792,
-	4587792,
-	4587904,
-	4588545,
-	4589824,
-	4591617,
-	4591617,
-	4595713,
-	4595728,
-	4603905,
-	4603906,
-	4603908,
-	4603908,
-	4603912,
-	4603912,
-	4603920,
-	4603920,
-	4603920,
-	4603920,
-	4603920,
-	4603920,
-	4603936,
-	4603968,
-	4604160,
-	4604928,
-	4608000,
-	4612096,
-	4620289,
-	4620289,
-	4620304,
-	4636672,
-	4718617,
-	4718641,
-	4718673,
-	4718673,
-	4718725,
-	4718729,
-	4718737,
-	4718737,
-	4718740,
-	4718768,
-	4718853,
-	4718865,
-	4718866,
-	4718868,
-	4718872,
-	4718913,
-	4718980,
-	4718980,
-	4718980,
-	4718984,
-	4718992,
-	4718992,
-	4719008,
-	4719040,
-	4719633,
-	4719876,
-	4720657,
-	4720664,
-	4720769,
-	4720784,
-	4720912,
-	4726849,
-	4726913,
-	4727041,
-	4727041,
-	4727041,
-	4727056,
-	4727056,
-	4727809,
-	4728064,
-	4734993,
-	4734994,
-	4735000,
-	4735120,
-	4735168,
-	4735233,
-	4735248,
-	4737040,
-	4737040,
-	4737152,
-	4739073,
-	4739200,
-	4743169,
-	4751617,
-	4751632,
-	4751744,
-	4849681,
-	4849681,
-	4849681,
-	4849744,
-	4849793,
-	4849793,
-	4849793,
-	4849793,
-	4849796,
-	4849808,
-	4849936,
-	4849936,
-	4849936,
-	4850048,
-	4850944,
-	4851713,
-	4851968,
-	4857857,
-	4866064,
-	4866064,
-	4866064,
-	4866064,
-	4866176,
-	4866176,
-	4866176,
-	4866176,
-	4866176,
-	4882433,
-	4882448,
-	4882688,
-	4980745,
-	4980745,
-	4980753,
-	4980753,
-	4980753,
-	4980753,
-	4980753,
-	4980753,
-	4980769,
-	4980784,
-	4980865,
-	4980865,
-	4980865,
-	4980880,
-	4980880,
-	4980993,
-	4980993,
-	4980993,
-	4981008,
-	4981008,
-	4981024,
-	4981056,
-	4981120,
-	4981120,
-	4981120,
-	4981120,
-	4982800,
-	4982800,
-	4983040,
-	4988929,
-	4988929,
-	4988929,
-	4988944,
-	4989184,
-	4997136,
-	4997136,
-	5005312,
-	5005312,
-	5005312,
-	5013520,
-	5029888,
-	5111809,
-	5111809,
-	5111809,
-	5111809,
-	5111809,
-	5111809,
-	5111824,
-	5111824,
-	5111824,
-	5112064,
-	5112064,
-	5128192,
-	5128192,
-	5128192,
-	5128192,
-	5242929,
-	5242968,
-	5243013,
-	5243073,
-	5243921,
-	5244033,
-	5244961,
-	5244961,
-	5246080,
-	5247233,
-	5251090,
-	5251096,
-	5251120,
-	5251392,
-	5253121,
-	5255184,
-	5259396,
-	5259456,
-	5261320,
-	5261344,
-	5261376,
-	5267458,
-	5267460,
-	5267464,
-	5275777,
-	5279872,
-	5309441,
-	5374081,
-	5382208,
-	5398528,
-	5506049,
-	5507073,
-	5509121,
-	5513217,
-	5513232,
-	5513280,
-	5529600,
-	5570561,
-	5636112,
-	5767177,
-	5767201,
-	5767312,
-	5775376,
-	5775616,
-	5800192,
-	6160384,
-	6291481,
-	6291729,
-	6291729,
-	6291736,
-	6291844,
-	6293521,
-	6299665,
-	6299920,
-	6307857,
-	6307864,
-	6307864,
-	6307864,
-	6309904,
-	6309904,
-	6316048,
-	6422545,
-	6422545,
-	6422800,
-	6422800,
-	6438928,
-	6553617,
-	6553872,
-	6553872,
-	6553872,
-	6569985,
-	6701056,
-	7340049,
-	7487488,
-	8388665,
-	8388761,
-	8388905,
-	8388920,
-	8388920,
-	8389893,
-	8390681,
-	8390917,
-	8390929,
-	8390929,
-	8390932,
-	8390960,
-	8391056,
-	8392969,
-	8392978,
-	8392980,
-	8392984,
-	8395009,
-	8396825,
-	8396946,
-	8397061,
-	8397073,
-	8397073,
-	8397076,
-	8397080,
-	8397080,
-	8397121,
-	8397136,
-	8398865,
-	8400913,
-	8401168,
-	8405013,
-	8405018,
-	8405020,
-	8405020,
-	8405048,
-	8405257,
-	8405272,
-	8405272,
-	8405296,
-	8407045,
-	8407064,
-	8407088,
-	8407297,
-	8407300,
-	8409106,
-	8409345,
-	8409360,
-	8409360,
-	8413189,
-	8413193,
-	8413201,
-	8413201,
-	8413202,
-	8413328,
-	8413441,
-	8413456,
-	8415233,
-	8417281,
-	8417281,
-	8423696,
-	8429825,
-	8437784,
-	8437784,
-	8438032,
-	8439936,
-	8440064,
-	8519701,
-	8519705,
-	8519945,
-	8519956,
-	8519960,
-	8519984,
-	8519984,
-	8521745,
-	8521745,
-	8521985,
-	8523785,
-	8523793,
-	8524048,
-	8524048,
-	8524048,
-	8528144,
-	8536067,
-	8536082,
-	8536082,
-	8536088,
-	8536112,
-	8536112,
-	8536112,
-	8536321,
-	8536336,
-	8544258,
-	8552720,
-	8650801,
-	8651056,
-	8651152,
-	8652805,
-	8652817,
-	8652817,
-	8653057,
-	8653057,
-	8653072,
-	8653072,
-	8654865,
-	8655105,
-	8655120,
-	8659216,
-	8667154,
-	8667156,
-	8667184,
-	8667216,
-	8667400,
-	8669200,
-	8671233,
-	8671488,
-	8671488,
-	8675329,
-	8675329,
-	8675344,
-	8683537,
-	8683538,
-	8683664,
-	8683792,
-	8699920,
-	8699920,
-	8781841,
-	8781841,
-	8782096,
-	8782096,
-	8798224,
-	8912917,
-	8912921,
-	8912921,
-	8913169,
-	8914961,
-	8914961,
-	8914984,
-	8915216,
-	8921105,
-	8921345,
-	8929540,
-	8931344,
-	8937473,
-	8937728,
-	8945688,
-	8947728,
-	8962064,
-	8964096,
-	9043985,
-	9043985,
-	9043985,
-	9044097,
-	9044225,
-	9060353,
-	9060368,
-	9175057,
-	9175057,
-	9175297,
-	9175312,
-	9175312,
-	9175312,
-	9175424,
-	9191440,
-	9306368,
-	9437203,
-	9437212,
-	9437720,
-	9439252,
-	9439265,
-	9439297,
-	9439489,
-	9439552,
-	9445393,
-	9445520,
-	9445633,
-	9445664,
-	9447425,
-	9449488,
-	9449728,
-	9453700,
-	9457666,
-	9461762,
-	9470209,
-	9470240,
-	9472016,
-	9474064,
-	9474304,
-	9474304,
-	9568261,
-	9568265,
-	9568274,
-	9568276,
-	9568280,
-	9570320,
-	9572368,
-	9572368,
-	9601040,
-	9699352,
-	9701392,
-	9707536,
-	9707536,
-	9715968,
-	9717760,
-	9830416,
-	9961985,
-	9963536,
-	9969665,
-	10223617,
-	10223632,
-	10223632,
-	10486034,
-	10488080,
-	10494224,
-	10617089,
-	12582937,
-	12582937,
-	12591121,
-	12714001,
-	12714001,
-	12845073,
-	13639681,
-	13664257,
-	16777243,
-	16777243,
-	16777243,
-	16777245,
-	16777245,
-	16777273,
-	16777293,
-	16777299,
-	16777301,
-	16777306,
-	16777369,
-	16777369,
-	16777432,
-	16777485,
-	16777497,
-	16777500,
-	16777528,
-	16777528,
-	16777554,
-	16777606,
-	16778247,
-	16778259,
-	16778261,
-	16778261,
-	16778262,
-	16778328,
-	16778373,
-	16778373,
-	16778508,
-	16778544,
-	16778628,
-	16778757,
-	16778769,
-	16779275,
-	16779275,
-	16779275,
-	16779277,
-	16779283,
-	16779283,
-	16779285,
-	16779285,
-	16779285,
-	16779289,
-	16779289,
-	16779289,
-	16779292,
-	16779292,
-	16779313,
-	16779313,
-	16779313,
-	16779337,
-	16779345,
-	16779345,
-	16779346,
-	16779352,
-	16779352,
-	16779395,
-	16779401,
-	16779409,
-	16779412,
-	16779425,
-	16779472,
-	16779523,
-	16779523,
-	16779529,
-	16779529,
-	16779532,
-	16779544,
-	16779568,
-	16779585,
-	16779586,
-	16779586,
-	16779649,
-	16779652,
-	16779664,
-	16779712,
-	16780291,
-	16780291,
-	16780297,
-	16780305,
-	16780305,
-	16780321,
-	16780353,
-	16780560,
-	16780560,
-	16781319,
-	16781331,
-	16781331,
-	16781331,
-	16781333,
-	16781337,
-	16781361,
-	16781393,
-	16781460,
-	16781577,
-	16781577,
-	16781640,
-	16782341,
-	16782596,
-	16782608,
-	16783363,
-	16783363,
-	16783365,
-	16783369,
-	16783377,
-	16783377,
-	16783393,
-	16783440,
-	16783618,
-	16783618,
-	16783624,
-	16783632,
-	16783632,
-	16783632,
-	16783648,
-	16784640,
-	16785419,
-	16785421,
-	16785421,
-	16785427,
-	16785433,
-	16785434,
-	16785445,
-	16785464,
-	16785475,
-	16785477,
-	16785489,
-	16785505,
-	16785545,
-	16785545,
-	16785545,
-	16785553,
-	16785553,
-	16785560,
-	16785560,
-	16785673,
-	16785676,
-	16785682,
-	16785684,
-	16785704,
-	16785730,
-	16785732,
-	16785736,
-	16785736,
-	16785744,
-	16785808,
-	16785856,
-	16785937,
-	16785938,
-	16786435,
-	16786449,
-	16786456,
-	16786497,
-	16786561,
-	16786689,
-	16786692,
-	16786696,
-	16787459,
-	16787465,
-	16787473,
-	16787473,
-	16787473,
-	16787473,
-	16787480,
-	16787588,
-	16787713,
-	16787713,
-	16787714,
-	16787720,
-	16787720,
-	16787728,
-	16787776,
-	16787776,
-	16788481,
-	16788496,
-	16788736,
-	16788736,
-	16789507,
-	16789513,
-	16789521,
-	16789521,
-	16789521,
-	16789528,
-	16789569,
-	16789633,
-	16789648,
-	16789764,
-	16789776,
-	16789824,
-	16790529,
-	16791553,
-	16791808,
-	16793611,
-	16793622,
-	16793628,
-	16793628,
-	16793637,
-	16793682,
-	16793688,
-	16793712,
-	16793733,
-	16793738,
-	16793793,
-	16793924,
-	16793992,
-	16794132,
-	16794136,
-	16794627,
-	16794644,
-	16794648,
-	16794756,
-	16794756,
-	16794768,
-	16794884,
-	16795152,
-	16795651,
-	16795653,
-	16795657,
-	16795666,
-	16795668,
-	16795672,
-	16795672,
-	16795672,
-	16795672,
-	16795672,
-	16795681,
-	16795688,
-	16795688,
-	16795696,
-	16795713,
-	16795714,
-	16795720,
-	16795720,
-	16795720,
-	16795728,
-	16795728,
-	16795780,
-	16795792,
-	16795792,
-	16795906,
-	16795912,
-	16796676,
-	16796676,
-	16796688,
-	16796688,
-	16796704,
-	16797702,
-	16797713,
-	16797729,
-	16797732,
-	16797828,
-	16797840,
-	16797960,
-	16798016,
-	16799745,
-	16799745,
-	16799748,
-	16799748,
-	16799752,
-	16799760,
-	16801797,
-	16801797,
-	16801801,
-	16801804,
-	16801804,
-	16801810,
-	16801810,
-	16801812,
-	16801816,
-	16801816,
-	16801857,
-	16801872,
-	16801936,
-	16802052,
-	16802052,
-	16802112,
-	16802112,
-	16802305,
-	16802320,
-	16802817,
-	16802820,
-	16802944,
-	16803841,
-	16803842,
-	16803872,
-	16804096,
-	16805889,
-	16805904,
-	16805904,
-	16805904,
-	16806144,
-	16810009,
-	16810129,
-	16810132,
-	16810136,
-	16811025,
-	16811028,
-	16811268,
-	16811280,
-	16811280,
-	16812049,
-	16812050,
-	16812052,
-	16812080,
-	16812097,
-	16812161,
-	16812161,
-	16812176,
-	16812224,
-	16812292,
-	16812352,
-	16812352,
-	16813072,
-	16814085,
-	16814089,
-	16814209,
-	16814209,
-	16814209,
-	16814224,
-	16814400,
-	16814400,
-	16814848,
-	16815120,
-	16816129,
-	16816129,
-	16816256,
-	16816384,
-	16816384,
-	16816384,
-	16818185,
-	16818193,
-	16818320,
-	16818433,
-	16818440,
-	16818448,
-	16819456,
-	16820240,
-	16820480,
-	16820480,
-	16822400,
-	16826392,
-	16826433,
-	16826440,
-	16826448,
-	16826498,
-	16826632,
-	16827393,
-	16827396,
-	16827408,
-	16828432,
-	16828432,
-	16830480,
-	16830480,
-	16830480,
-	16834561,
-	16834568,
-	16834576,
-	16834576,
-	16834688,
-	16836608,
-	16908295,
-	16908299,
-	16908299,
-	16908299,
-	16908301,
-	16908307,
-	16908307,
-	16908307,
-	16908307,
-	16908309,
-	16908309,
-	16908310,
-	16908310,
-	16908313,
-	16908313,
-	16908313,
-	16908313,
-	16908313,
-	16908314,
-	16908316,
-	16908316,
-	16908316,
-	16908323,
-	16908325,
-	16908337,
-	16908337,
-	16908337,
-	16908357,
-	16908361,
-	16908369,
-	16908369,
-	16908369,
-	16908370,
-	16908376,
-	16908376,
-	16908421,
-	16908421,
-	16908425,
-	16908425,
-	16908433,
-	16908434,
-	16908553,
-	16908553,
-	16908553,
-	16908554,
-	16908554,
-	16908561,
-	16908564,
-	16908564,
-	16908577,
-	16908578,
-	16908592,
-	16908592,
-	16908612,
-	16908616,
-	16908616,
-	16908616,
-	16908673,
-	16909315,
-	16909315,
-	16909321,
-	16909329,
-	16909336,
-	16909336,
-	16909569,
-	16909570,
-	16909570,
-	16909572,
-	16909584,
-	16909840,
-	16910339,
-	16910341,
-	16910341,
-	16910341,
-	16910341,
-	16910345,
-	16910345,
-	16910345,
-	16910345,
-	16910353,
-	16910353,
-	16910353,
-	16910353,
-	16910354,
-	16910356,
-	16910356,
-	16910360,
-	16910369,
-	16910384,
-	16910384,
-	16910384,
-	16910401,
-	16910401,
-	16910401,
-	16910593,
-	16910593,
-	16910596,
-	16910596,
-	16910600,
-	16910600,
-	16910600,
-	16910608,
-	16910656,
-	16911361,
-	16912387,
-	16912387,
-	16912389,
-	16912393,
-	16912401,
-	16912401,
-	16912404,
-	16912417,
-	16912449,
-	16912464,
-	16912528,
-	16912704,
-	16913664,
-	16914433,
-	16914433,
-	16914688,
-	16916483,
-	16916483,
-	16916485,
-	16916485,
-	16916485,
-	16916489,
-	16916497,
-	16916497,
-	16916497,
-	16916504,
-	16916513,
-	16916528,
-	16916545,
-	16916545,
-	16916624,
-	16916737,
-	16916737,
-	16916738,
-	16916738,
-	16916744,
-	16916800,
-	16916800,
-	16917505,
-	16917520,
-	16924675,
-	16924677,
-	16924678,
-	16924681,
-	16924684,
-	16924690,
-	16924692,
-	16924692,
-	16924696,
-	16924705,
-	16924706,
-	16924708,
-	16924712,
-	16924720,
-	16924801,
-	16924804,
-	16924808,
-	16924929,
-	16925700,
-	16925700,
-	16925712,
-	16925712,
-	16925712,
-	16925728,
-	16926721,
-	16926722,
-	16926724,
-	16926724,
-	16926728,
-	16926728,
-	16926752,
-	16926784,
-	16926976,
-	16928769,
-	16928769,
-	16928776,
-	16928784,
-	16928784,
-	16928800,
-	16932865,
-	16932866,
-	16932866,
-	16932868,
-	16932868,
-	16932872,
-	16932880,
-	16932880,
-	16932928,
-	16932992,
-	16933120,
-	16936960,
-	16941061,
-	16941065,
-	16941073,
-	16941073,
-	16941073,
-	16941076,
-	16941076,
-	16941076,
-	16941080,
-	16941080,
-	16941121,
-	16941136,
-	16941185,
-	16941200,
-	16941248,
-	16941316,
-	16941316,
-	16941316,
-	16941320,
-	16941376,
-	16942081,
-	16942096,
-	16943105,
-	16943105,
-	16943105,
-	16943120,
-	16943120,
-	16943120,
-	16945408,
-	16949249,
-	16949504,
-	16957441,
-	16957456,
-	16957504,
-	16958464,
-	16961536,
-	17039379,
-	17039379,
-	17039379,
-	17039381,
-	17039412,
-	17039442,
-	17039448,
-	17039493,
-	17039497,
-	17039497,
-	17039505,
-	17039508,
-	17039553,
-	17039625,
-	17039625,
-	17039649,
-	17039681,
-	17039752,
-	17039776,
-	17039889,
-	17040389,
-	17040389,
-	17040408,
-	17040408,
-	17040432,
-	17040513,
-	17040513,
-	17040641,
-	17040656,
-	17040656,
-	17040768,
-	17041411,
-	17041411,
-	17041413,
-	17041413,
-	17041413,
-	17041413,
-	17041417,
-	17041420,
-	17041425,
-	17041425,
-	17041425,
-	17041425,
-	17041432,
-	17041432,
-	17041441,
-	17041456,
-	17041488,
-	17041537,
-	17041537,
-	17041665,
-	17041665,
-	17041666,
-	17041666,
-	17041672,
-	17041672,
-	17041680,
-	17041792,
-	17042433,
-	17042448,
-	17042688,
-	17043459,
-	17043461,
-	17043473,
-	17043476,
-	17043480,
-	17043585,
-	17043585,
-	17043600,
-	17043713,
-	17043720,
-	17044736,
-	17045505,
-	17045520,
-	17045520,
-	17045760,
-	17045760,
-	17045760,
-	17045760,
-	17047557,
-	17047557,
-	17047557,
-	17047561,
-	17047561,
-	17047569,
-	17047569,
-	17047570,
-	17047576,
-	17047576,
-	17047617,
-	17047617,
-	17047632,
-	17047684,
-	17047809,
-	17047936,
-	17048577,
-	17048577,
-	17048592,
-	17048832,
-	17049856,
-	17051649,
-	17051776,
-	17055749,
-	17055762,
-	17055762,
-	17055764,
-	17055777,
-	17055809,
-	17055873,
-	17055880,
-	17055888,
-	17055936,
-	17056064,
-	17056272,
-	17056272,
-	17056769,
-	17056769,
-	17056769,
-	17056770,
-	17056772,
-	17056772,
-	17056784,
-	17057793,
-	17057796,
-	17057800,
-	17057800,
-	17058048,
-	17058816,
-	17059856,
-	17060864,
-	17063940,
-	17063940,
-	17063940,
-	17063944,
-	17063944,
-	17063952,
-	17064000,
-	17064000,
-	17064064,
-	17064192,
-	17064192,
-	17065984,
-	17072133,
-	17072145,
-	17072146,
-	17072193,
-	17072257,
-	17072257,
-	17072260,
-	17072272,
-	17072385,
-	17072388,
-	17072392,
-	17072400,
-	17072448,
-	17073168,
-	17073408,
-	17073408,
-	17074177,
-	17074177,
-	17074177,
-	17074192,
-	17074192,
-	17074304,
-	17080321,
-	17080321,
-	17080336,
-	17080576,
-	17080576,
-	17080576,
-	17088513,
-	17088516,
-	17088528,
-	17088528,
-	17088528,
-	17088640,
-	17088640,
-	17089536,
-	17090560,
-	17090560,
-	17090560,
-	17092608,
-	17092608,
-	17096704,
-	17105153,
-	17170435,
-	17170437,
-	17170437,
-	17170437,
-	17170437,
-	17170441,
-	17170441,
-	17170441,
-	17170449,
-	17170449,
-	17170449,
-	17170449,
-	17170449,
-	17170449,
-	17170450,
-	17170452,
-	17170456,
-	17170465,
-	17170497,
-	17170512,
-	17170512,
-	17170576,
-	17170576,
-	17170689,
-	17170689,
-	17170690,
-	17170696,
-	17171457,
-	17171457,
-	17171472,
-	17171472,
-	17171472,
-	17171712,
-	17171712,
-	17172481,
-	17172481,
-	17172482,
-	17172496,
-	17172496,
-	17174529,
-	17174529,
-	17178625,
-	17178625,
-	17178632,
-	17178640,
-	17186817,
-	17186818,
-	17186820,
-	17186832,
-	17186832,
-	17186880,
-	17186880,
-	17186944,
-	17203201,
-	17203201,
-	17203201,
-	17203201,
-	17203216,
-	17203216,
-	17203216,
-	17203216,
-	17203456,
-	17219584,
-	17301541,
-	17301553,
-	17301637,
-	17301637,
-	17301637,
-	17301652,
-	17301652,
-	17301656,
-	17301680,
-	17301712,
-	17301772,
-	17301778,
-	17301784,
-	17301784,
-	17301784,
-	17301892,
-	17301952,
-	17302533,
-	17302545,
-	17302657,
-	17302672,
-	17302788,
-	17303569,
-	17303569,
-	17303572,
-	17303585,
-	17303600,
-	17303600,
-	17303600,
-	17303681,
-	17303696,
-	17303696,
-	17303696,
-	17303809,
-	17303809,
-	17303809,
-	17303809,
-	17303812,
-	17303840,
-	17303872,
-	17303936,
-	17304577,
-	17304592,
-	17304592,
-	17304832,
-	17305617,
-	17305617,
-	17305617,
-	17305744,
-	17305857,
-	17305857,
-	17305872,
-	17305984,
-	17307649,
-	17307904,
-	17309699,
-	17309701,
-	17309705,
-	17309713,
-	17309714,
-	17309720,
-	17309720,
-	17309720,
-	17309761,
-	17309776,
-	17309984,
-	17310016,
-	17310209,
-	17310736,
-	17311760,
-	17312000,
-	17313793,
-	17313793,
-	17314048,
-	17317897,
-	17317897,
-	17317897,
-	17317908,
-	17317912,
-	17317953,
-	17317968,
-	17317968,
-	17318018,
-	17318020,
-	17318024,
-	17318913,
-	17318913,
-	17319938,
-	17319940,
-	17319940,
-	17319944,
-	17319952,
-	17319968,
-	17319968,
-	17319968,
-	17320064,
-	17320448,
-	17321985,
-	17322000,
-	17322112,
-	17322240,
-	17326081,
-	17326081,
-	17326084,
-	17330176,
-	17334289,
-	17334296,
-	17334352,
-	17334401,
-	17334401,
-	17334532,
-	17334544,
-	17334656,
-	17336321,
-	17336321,
-	17336321,
-	17336321,
-	17338384,
-	17342465,
-	17350657,
-	17358848,
-	17432579,
-	17432581,
-	17432581,
-	17432585,
-	17432585,
-	17432593,
-	17432593,
-	17432596,
-	17432600,
-	17432609,
-	17432705,
-	17432705,
-	17432712,
-	17432720,
-	17432833,
-	17432840,
-	17432864,
-	17432960,
-	17433601,
-	17434625,
-	17434625,
-	17434640,
-	17436673,
-	17436673,
-	17440769,
-	17440784,
-	17448961,
-	17448962,
-	17448962,
-	17448968,
-	17448976,
-	17448976,
-	17448992,
-	17465345,
-	17465345,
-	17465348,
-	17465360,
-	17465360,
-	17465600,
-	17481728,
-	17563653,
-	17563653,
-	17563665,
-	17563665,
-	17563666,
-	17563666,
-	17563672,
-	17563696,
-	17563713,
-	17563777,
-	17563777,
-	17563780,
-	17563906,
-	17563912,
-	17563920,
-	17563920,
-	17563936,
-	17564673,
-	17564688,
-	17564688,
-	17564688,
-	17565697,
-	17565697,
-	17565697,
-	17565712,
-	17565952,
-	17565952,
-	17565952,
-	17567745,
-	17567745,
-	17567872,
-	17567872,
-	17567872,
-	17568000,
-	17568000,
-	17571841,
-	17571841,
-	17571841,
-	17571841,
-	17571841,
-	17571856,
-	17571856,
-	17571872,
-	17572096,
-	17572096,
-	17580036,
-	17580040,
-	17580064,
-	17580096,
-	17580160,
-	17582080,
-	17588224,
-	17596417,
-	17596417,
-	17596432,
-	17596672,
-	17612800,
-	17612800,
-	17612800,
-	17694721,
-	17694721,
-	17694721,
-	17694721,
-	17694721,
-	17694721,
-	17694721,
-	17694724,
-	17694736,
-	17694736,
-	17694736,
-	17694736,
-	17694848,
-	17698816,
-	17711104,
-	17711104,
-	17711104,
-	17711104,
-	17711104,
-	17711104,
-	17825803,
-	17825811,
-	17825859,
-	17825861,
-	17825865,
-	17825866,
-	17825873,
-	17825880,
-	17825896,
-	17825925,
-	17825932,
-	17826180,
-	17826564,
-	17826822,
-	17826828,
-	17827849,
-	17827858,
-	17827888,
-	17827906,
-	17827920,
-	17827936,
-	17828160,
-	17828866,
-	17828868,
-	17828896,
-	17828992,
-	17829891,
-	17829893,
-	17829898,
-	17829953,
-	17829954,
-	17830402,
-	17830916,
-	17830920,
-	17831940,
-	17831940,
-	17831940,
-	17831952,
-	17832000,
-	17832064,
-	17833987,
-	17833987,
-	17833989,
-	17833994,
-	17833996,
-	17834004,
-	17834008,
-	17834050,
-	17834056,
-	17834056,
-	17834272,
-	17834504,
-	17835024,
-	17835040,
-	17835072,
-	17835072,
-	17835136,
-	17835520,
-	17836033,
-	17836033,
-	17836096,
-	17838081,
-	17838081,
-	17838144,
-	17842179,
-	17842179,
-	17842182,
-	17842248,
-	17844240,
-	17846280,
-	17846280,
-	17848320,
-	17850369,
-	17850370,
-	17850372,
-	17850376,
-	17850432,
-	17851392,
-	17858563,
-	17858565,
-	17858578,
-	17858632,
-	17859585,
-	17860609,
-	17860609,
-	17860616,
-	17860640,
-	17860672,
-	17862658,
-	17862664,
-	17862784,
-	17863168,
-	17864704,
-	17864704,
-	17866753,
-	17866816,
-	17867776,
-	17874948,
-	17874948,
-	17883136,
-	17891585,
-	17892353,
-	17895440,
-	17956870,
-	17956876,
-	17956876,
-	17956882,
-	17956882,
-	17956929,
-	17956930,
-	17956936,
-	17956944,
-	17957889,
-	17957889,
-	17957892,
-	17958913,
-	17958913,
-	17958914,
-	17958916,
-	17958920,
-	17958928,
-	17958944,
-	17958976,
-	17959040,
-	17959936,
-	17960962,
-	17961984,
-	17963008,
-	17963008,
-	17965057,
-	17965057,
-	17965057,
-	17965058,
-	17965058,
-	17965064,
-	17967104,
-	17973256,
-	17973264,
-	17973312,
-	17973312,
-	17973312,
-	17974272,
-	17974272,
-	17975296,
-	17981440,
-	17989636,
-	17989640,
-	17989640,
-	17989640,
-	17989648,
-	17993728,
-	18006016,
-	18022416,
-	18087941,
-	18087941,
-	18087945,
-	18087945,
-	18087970,
-	18088001,
-	18088066,
-	18088068,
-	18088128,
-	18088449,
-	18088962,
-	18088964,
-	18088968,
-	18088976,
-	18088976,
-	18089088,
-	18089988,
-	18090000,
-	18090048,
-	18090112,
-	18091008,
-	18091008,
-	18092160,
-	18093056,
-	18093056,
-	18096129,
-	18096129,
-	18096256,
-	18098176,
-	18104321,
-	18104322,
-	18104322,
-	18104322,
-	18104336,
-	18104384,
-	18104448,
-	18104448,
-	18106368,
-	18106368,
-	18108416,
-	18120705,
-	18120712,
-	18120720,
-	18120832,
-	18124800,
-	18137088,
-	18137088,
-	18153473,
-	18153488,
-	18219009,
-	18219009,
-	18219010,
-	18219012,
-	18219016,
-	18219040,
-	18219072,
-	18219072,
-	18219072,
-	18219136,
-	18220032,
-	18221056,
-	18227200,
-	18227200,
-	18235392,
-	18235392,
-	18251776,
-	18251776,
-	18251776,
-	18350100,
-	18350209,
-	18350212,
-	18351105,
-	18351108,
-	18352130,
-	18352160,
-	18352160,
-	18354208,
-	18358273,
-	18358274,
-	18358274,
-	18358528,
-	18366466,
-	18366496,
-	18366528,
-	18366528,
-	18366592,
-	18368512,
-	18368512,
-	18386944,
-	18391040,
-	18399232,
-	18481153,
-	18481154,
-	18481160,
-	18481168,
-	18481184,
-	18481216,
-	18481280,
-	18483200,
-	18483200,
-	18489344,
-	18497536,
-	18513920,
-	18612225,
-	18612226,
-	18612232,
-	18612232,
-	18612240,
-	18612256,
-	18612288,
-	18612288,
-	18612352,
-	18612480,
-	18613248,
-	18614272,
-	18614272,
-	18616320,
-	18620416,
-	18620416,
-	18628608,
-	18743296,
-	18743296,
-	18874389,
-	18874456,
-	18874513,
-	18874516,
-	18874633,
-	18874704,
-	18874756,
-	18874756,
-	18875137,
-	18875652,
-	18876421,
-	18876433,
-	18876433,
-	18876688,
-	18880513,
-	18882577,
-	18882832,
-	18882880,
-	18883600,
-	18884864,
-	18890770,
-	18890772,
-	18890776,
-	18892816,
-	18898960,
-	18898960,
-	18898960,
-	18899200,
-	18907153,
-	19005445,
-	19005449,
-	19005457,
-	19005457,
-	19005457,
-	19005457,
-	19005458,
-	19005488,
-	19005505,
-	19005697,
-	19005697,
-	19005704,
-	19005953,
-	19009537,
-	19013648,
-	19021825,
-	19021832,
-	19021888,
-	19022080,
-	19038464,
-	19136529,
-	19136529,
-	19136529,
-	19136592,
-	19136784,
-	19136896,
-	19137792,
-	19138561,
-	19138561,
-	19144720,
-	19144960,
-	19152897,
-	19152900,
-	19415041,
-	19529744,
-	19529984,
-	19660801,
-	19661056,
-	19922953,
-	19939344,
-	20054020,
-	20578304,
-	20971531,
-	20971545,
-	20971587,
-	20971608,
-	20971668,
-	20972549,
-	20972549,
-	20972553,
-	20972561,
-	20972568,
-	20972609,
-	20972673,
-	20972804,
-	20973571,
-	20973571,
-	20973592,
-	20973601,
-	20973648,
-	20973697,
-	20973825,
-	20974593,
-	20976641,
-	20979717,
-	20979721,
-	20979721,
-	20979729,
-	20979729,
-	20979736,
-	20979745,
-	20979976,
-	20979984,
-	20980032,
-	20980096,
-	20980737,
-	20981761,
-	20981761,
-	20981776,
-	20982016,
-	20987913,
-	20987928,
-	20987976,
-	20987976,
-	20988040,
-	20988176,
-	20989954,
-	20989954,
-	20989960,
-	20989960,
-	20990464,
-	20992002,
-	20996097,
-	20996104,
-	20997120,
-	21005313,
-	21021184,
-	21028864,
-	21102609,
-	21102610,
-	21103120,
-	21103617,
-	21104641,
-	21104641,
-	21118980,
-	21118984,
-	21118984,
-	21118984,
-	21119008,
-	21119104,
-	21120000,
-	21121024,
-	21123072,
-	21233729,
-	21233793,
-	21233793,
-	21233808,
-	21234048,
-	21234704,
-	21234944,
-	21235713,
-	21235728,
-	21237761,
-	21238016,
-	21241857,
-	21241857,
-	21241864,
-	21241872,
-	21250050,
-	21250064,
-	21250176,
-	21252096,
-	21258240,
-	21258240,
-	21266433,
-	21266433,
-	21266448,
-	21266688,
-	21266688,
-	21282816,
-	21495811,
-	21495832,
-	21495841,
-	21495856,
-	21495937,
-	21495952,
-	21496065,
-	21496192,
-	21496192,
-	21497857,
-	21497872,
-	21497872,
-	21497872,
-	21498112,
-	21504001,
-	21504001,
-	21504256,
-	21512448,
-	21520384,
-	21528577,
-	21626881,
-	21626896,
-	21643264,
-	21757953,
-	21757968,
-	21757968,
-	21757968,
-	21774336,
-	22052865,
-	22153216,
-	22159360,
-	23068689,
-	23068944,
-	23199760,
-	25167877,
-	25167905,
-	25168016,
-	25168129,
-	25168132,
-	25168132,
-	25169152,
-	25171984,
-	25176065,
-	25176080,
-	25182213,
-	25182217,
-	25182232,
-	25182472,
-	25184288,
-	25184288,
-	25192448,
-	25198864,
-	25199105,
-	25202689,
-	25214992,
-	25296899,
-	25296914,
-	25297025,
-	25297160,
-	25297936,
-	25329680,
-	25329680,
-	25346048,
-	25430032,
-	25436416,
-	25460752,
-	25460992,
-	25559296,
-	25706498,
-	25821440,
-	25837568,
-	25952512,
-	25952512,
-	26345480,
-	29392912,
-	33554489,
-	33554521,
-	33554585,
-	33554707,
-	33554713,
-	33554725,
-	33554769,
-	33554769,
-	33554821,
-	33554849,
-	33554881,
-	33555745,
-	33556499,
-	33556505,
-	33556561,
-	33556561,
-	33556625,
-	33556625,
-	33556753,
-	33556753,
-	33556754,
-	33556754,
-	33556868,
-	33558553,
-	33558789,
-	33558801,
-	33560593,
-	33560593,
-	33562643,
-	33562649,
-	33562769,
-	33562897,
-	33562898,
-	33562898,
-	33562904,
-	33562945,
-	33563024,
-	33563024,
-	33563905,
-	33563920,
-	33563920,
-	33566977,
-	33566977,
-	33566992,
-	33566992,
-	33570841,
-	33570844,
-	33570949,
-	33571077,
-	33571081,
-	33571081,
-	33571092,
-	33571969,
-	33572867,
-	33572869,
-	33572881,
-	33572881,
-	33572884,
-	33572944,
-	33574915,
-	33575170,
-	33575232,
-	33579013,
-	33579017,
-	33579025,
-	33579025,
-	33579026,
-	33579026,
-	33579028,
-	33579032,
-	33579032,
-	33579032,
-	33579073,
-	33579073,
-	33579268,
-	33579268,
-	33579328,
-	33581057,
-	33581057,
-	33603856,
-	33685523,
-	33685523,
-	33685525,
-	33685529,
-	33685529,
-	33685529,
-	33685553,
-	33685585,
-	33685585,
-	33685649,
-	33685763,
-	33685765,
-	33685769,
-	33685777,
-	33685808,
-	33685889,
-	33686545,
-	33686785,
-	33689617,
-	33689617,
-	33689857,
-	33689857,
-	33689857,
-	33693729,
-	33693953,
-	33701908,
-	33701912,
-	33701936,
-	33702160,
-	33702913,
-	33704192,
-	33710081,
-	33710096,
-	33718544,
-	33816601,
-	33816601,
-	33816625,
-	33816657,
-	33816721,
-	33816835,
-	33816850,
-	33816856,
-	33816964,
-	33818629,
-	33818641,
-	33818641,
-	33818881,
-	33820689,
-	33820689,
-	33820944,
-	33824785,
-	33824785,
-	33825025,
-	33825028,
-	33825040,
-	33825088,
-	33832977,
-	33832980,
-	33832984,
-	33833217,
-	33837057,
-	33837312,
-	33841153,
-	33841168,
-	33841408,
-	33849616,
-	33947653,
-	33947665,
-	33947681,
-	33947905,
-	33947905,
-	33947920,
-	33964048,
-	33964096,
-	33964288,
-	34078741,
-	34078801,
-	34078979,
-	34078994,
-	34078994,
-	34078996,
-	34081026,
-	34081040,
-	34086929,
-	34095121,
-	34095233,
-	34095376,
-	34097168,
-	34099201,
-	34103297,
-	34127873,
-	34209936,
-	34210049,
-	34210080,
-	34218000,
-	34226178,
-	34226192,
-	34226192,
-	34340881,
-	34341136,
-	34343168,
-	34349312,
-	34357504,
-	34373888,
-	34471937,
-	34603027,
-	34603064,
-	34603089,
-	34603090,
-	34604035,
-	34604050,
-	34604416,
-	34605344,
-	34607121,
-	34607240,
-	34611205,
-	34611336,
-	34612225,
-	34619584,
-	34620417,
-	34621456,
-	34644224,
-	34668561,
-	34684944,
-	34734097,
-	34734098,
-	34734104,
-	34734128,
-	34734344,
-	34738177,
-	34738177,
-	34742273,
-	34754560,
-	34865170,
-	34865200,
-	34873345,
-	34873600,
-	34883584,
-	34897921,
-	34930944,
-	35129345,
-	35129376,
-	35130368,
-	35131393,
-	35139584,
-	35668496,
-	35799041,
-	35799296,
-	37756945,
-	37757192,
-	37757200,
-	37757200,
-	37765392,
-	37880065,
-	38011137,
-	38011152,
-	38273281,
-	38275073,
-	42205201,
-	50331781,
-	50331793,
-	50331928,
-	50332177,
-	50332417,
-	50333699,
-	50333761,
-	50333761,
-	50335761,
-	50336004,
-	50340097,
-	50340100,
-	50340112,
-	50340160,
-	50340865,
-	50341120,
-	50343952,
-	50344192,
-	50348052,
-	50348065,
-	50356288,
-	50462725,
-	50479105,
-	50597904,
-	50612224,
-	50864129,
-	50874368,
-	50987264,
-	51118096,
-	51380289,
-	51396624,
-	51511297,
-	51511328,
-	54528001,
-	58736641,
-	0
-};
-
-#define	HASHSZ            204800
-
-uint32_t keymap[HASHSZ] __attribute__ ((aligned(64)));
-uint32_t posmap[HASHSZ] __attribute__ ((aligned(64)));
-uint32_t hash_collisions;
-
-
-void
-print_time_taken(char *label, struct timespec *ts, struct timespec *te)
-{
-	int64_t time_taken = 1000000000LL;	// Number of ns in 1s
-	time_taken *= (te->tv_sec - ts->tv_sec);
-	time_taken += (te->tv_nsec - ts->tv_nsec);
-
-	printf("%-20s = %ld.%06lus\n", label, time_taken / 1000000000, (time_taken % 1000000000) / 1000);
-} // print_time_taken
- 
-
-static void
-hash_init(size_t len)
-{
-	memset(keymap, 0, len * sizeof(*keymap));
-	hash_collisions = 0;
-} // hash_init
-
-
-//********************* HASH TABLE FUNCTIONS **********************
-
-// A very simple for-purpose hash map implementation.  Used to
-// lookup words given the key representation of that word
-uint32_t
-hash_insert( uint32_t key,  uint32_t pos,  uint32_t hashsz)
-{
-	 uint32_t col = 0, hashpos = key % hashsz;
-
-	do {
-		if (keymap[hashpos] == 0)
-			break;
-
-		// Check if duplicate key
-		if (keymap[hashpos] == key)
-			return 0;
-
-		// Handle full hash table condition
-		if (++col == hashsz)
-			return 0;
-
-		if (++hashpos == hashsz)
-			hashpos -= hashsz;
-	} while (1);
-
-	// Now insert at hash location
-	keymap[hashpos] = key;
-	posmap[hashpos] = pos * 5;
-
-	hash_collisions += col;
-
-	return key;
-} // hash_insert
-
-uint32_t
-hash_lookup( uint32_t key,  uint32_t hashsz)
-{
-	 uint32_t col = 0, hashpos = key % hashsz;
-
-	do {
-		if (keymap[hashpos] == key)
-			break;
-
-		if (keymap[hashpos] == 0)
-			return UINT32_MAX;
-
-		// Handle full hash table condition
-		if (++col == hashsz)
-			return UINT32_MAX;
-
-		if (++hashpos == hashsz)
-			hashpos -= hashsz;
-	} while (1);
-
-	hash_collisions += col;
-
-	return posmap[hashpos];
-} // hash_insert
-
-
-int
-main(int argc, char *argv[])
-{
-	struct timespec ts[1], te[1];
-	int nkeys = sizeof(keys) / sizeof(*keys);
-	int64_t min_time_taken = 1000000000LL;
-	uint32_t min_col = 10000;
-	int64_t time_taken = 1000000000LL;
-	uint32_t key, *k;
-	uint32_t hashsz = atoi(argv[1]);
-
-	if (hashsz < (nkeys + 100))
-		exit(1);
-
-	if (hashsz > HASHSZ) {
-		printf("hash size must be no larger than %d\n", HASHSZ);
-		exit(1);
-	}
-
-	clock_gettime(CLOCK_MONOTONIC, ts);
-
-	hash_init(hashsz);
-
-	k = keys;
-	while ((key = *k++))
-		hash_insert(key, (uint32_t)(k - keys), hashsz);
-
-	k = keys;
-	while ((key = *k++))
-		hash_lookup(key, hashsz);
-
-	clock_gettime(CLOCK_MONOTONIC, te);
-
-	time_taken *= (te->tv_sec - ts->tv_sec);
-	time_taken += (te->tv_nsec - ts->tv_nsec);
-
-	if (time_taken < min_time_taken) {
-		printf("HASHSZ= %6u   Collisions= %6u   TIME_TAKEN_NS= %8ld\n", hashsz, hash_collisions, time_taken);
-		min_time_taken = time_taken;
-	}
-	return 0;
-} // main
@@ -0,0 +1,260 @@
+// Hash table benchmark for the Parker 5x5 Unique Word Problem
+//
+// Loads the key set from a word file through the same find_words() path as
+// the solvers, and then measures each candidate key hash function over a
+// sweep of hash table sizes, using the same linear probing as utilities.h
+//
+// Usage: hash_bench [-f word-file] [-r repeats] [-b min_bits-max_bits]
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <nmmintrin.h>
+
+// NUM_POISON must be defined before include utilities.h
+#define	NUM_POISON	0
+#define DONT_INCLUDE_MAIN
+#define NO_FREQ_SETUP
+#undef WORD_INDEX
+
+#include "utilities.h"
+
+// We only read words, so the solver entry points do nothing
+static void __attribute__((unused)) solve() {}
+static void solve_work() {}
+
+#define MAX_BITS	22
+#define PROBE_BUCKETS	8
+
+// Hash tables of up to MAX_BITS in size
+static uint32_t	bkeymap[1 << MAX_BITS] __attribute__ ((aligned(64)));
+static uint32_t	bposmap[1 << MAX_BITS] __attribute__ ((aligned(64)));
+
+// ********************* CANDIDATE HASH FUNCTIONS ********************
+
+// Each returns a hash value that is reduced to a table position either by
+// masking off the low bits, or by taking the high bits for the ones that
+// multiply up into the top of the word
+
+static uint32_t hash_5287(uint32_t x)	{ return KEY_HASH_5287(x); }
+static uint32_t hash_13334(uint32_t x)	{ return KEY_HASH_13334(x); }
+static uint32_t hash_shifts(uint32_t x)	{ return KEY_HASH_SHIFTS(x); }
+static uint32_t hash_identity(uint32_t x) { return x; }
+static uint32_t hash_fibonacci(uint32_t x) { return x * 2654435769U; }
+static uint32_t hash_crc32c(uint32_t x)	{ return _mm_crc32_u32(0, x); }
+
+static uint32_t
+hash_murmur(uint32_t x)
+{
+	x ^= x >> 16; x *= 0x85EBCA6BU;
+	x ^= x >> 13; x *= 0xC2B2AE35U;
+	return x ^ (x >> 16);
+} // hash_murmur
+
+static struct candidate {
+	const char	*name;
+	uint32_t	(*hash)(uint32_t);
+	int		high;	// Use the high bits instead of the low bits
+} candidates[] = {
+	{ "5287",	hash_5287,	0 },	// utilities.h key_hash()
+	{ "13334",	hash_13334,	0 },
+	{ "shifts",	hash_shifts,	0 },
+	{ "identity",	hash_identity,	0 },
+	{ "fibonacci",	hash_fibonacci,	1 },
+	{ "murmur",	hash_murmur,	0 },
+	{ "crc32c",	hash_crc32c,	0 },
+};
+
+#define NUM_CANDIDATES	(sizeof(candidates) / sizeof(*candidates))
+
+// ********************* MEASUREMENTS ********************
+
+struct result {
+	uint64_t	insert_ns;
+	uint64_t	lookup_ns;
+	uint64_t	probes;		// Total probes over all lookups
+	uint32_t	max_probe;
+	uint32_t	hist[PROBE_BUCKETS];	// 0, 1, 2, 3, 4-7, 8-15, 16-31, 32+
+};
+
+static inline uint32_t
+table_pos(struct candidate *c, uint32_t key, uint32_t bits)
+{
+	uint32_t h = c->hash(key);
+
+	return c->high ? (h >> (32 - bits)) : (h & ((1U << bits) - 1));
+} // table_pos
+
+static inline int
+probe_bucket(uint32_t probes)
+{
+	return (probes < 4) ? probes : (31 - __builtin_clz(probes)) + 2;
+} // probe_bucket
+
+// Inserts all the keys, the same way that utilities.h does
+static void
+bench_insert(struct candidate *c, uint32_t bits)
+{
+	uint32_t mask = (1U << bits) - 1;
+
+	memset(bkeymap, 0, sizeof(*bkeymap) << bits);
+
+	for (uint32_t *kp = ctx->keys, key; (key = *kp); kp++) {
+		uint32_t pos = table_pos(c, key, bits);
+
+		while (bkeymap[pos] && (bkeymap[pos] != key))
+			pos = (pos + 1) & mask;
+
+		bkeymap[pos] = key;
+		bposmap[pos] = kp - ctx->keys;
+	}
+} // bench_insert
+
+// Looks up all the keys.  Returns the sum of the positions that were found
+// so that the compiler can't throw the lookups away
+static uint32_t
+bench_lookup(struct candidate *c, uint32_t bits, struct result *r)
+{
+	uint32_t mask = (1U << bits) - 1, sum = 0;
+
+	for (uint32_t *kp = ctx->keys, key; (key = *kp); kp++) {
+		uint32_t pos = table_pos(c, key, bits), probes = 0;
+
+		while (bkeymap[pos] != key) {
+			pos = (pos + 1) & mask;
+			probes++;
+		}
+		sum += bposmap[pos];
+
+		if (r) {
+			r->probes += probes;
+			if (probes > r->max_probe)
+				r->max_probe = probes;
+			r->hist[probe_bucket(probes)]++;
+		}
+	}
+	return sum;
+} // bench_lookup
+
+static void
+bench(struct candidate *c, uint32_t bits, int repeats, struct result *r)
+{
+	uint32_t sum = 0;
+
+	memset(r, 0, sizeof(*r));
+	r->insert_ns = r->lookup_ns = UINT64_MAX;
+
+	// Keep the fastest of the repeats, as that's the least disturbed
+	for (int i = 0; i < repeats; i++) {
+		uint64_t t1 = get_ns();
+		bench_insert(c, bits);
+		uint64_t t2 = get_ns();
+		sum += bench_lookup(c, bits, NULL);
+		uint64_t t3 = get_ns();
+
+		if ((t2 - t1) < r->insert_ns)
+			r->insert_ns = t2 - t1;
+		if ((t3 - t2) < r->lookup_ns)
+			r->lookup_ns = t3 - t2;
+	}
+
+	// Probe lengths are the same every time, so count them just once
+	sum += bench_lookup(c, bits, r);
+
+	if (sum == 0x5A5A5A5A)
+		printf("\n");
+} // bench
+
+int
+main(int argc, char *argv[])
+{
+	char file[256];
+	int repeats = 20, min_bits = 0, max_bits = 0;
+
+	strcpy(file, "words_alpha.txt");
+	settings_init();
+
+	for (int i = 1; i < argc; i++) {
+		if (!strncmp(argv[i], "-f", 2) && ((i + 1) < argc)) {
+			strncpy(file, argv[++i], 255);
+			file[255] = '\0';
+			continue;
+		}
+
+		if (!strncmp(argv[i], "-r", 2) && ((i + 1) < argc)) {
+			repeats = atoi(argv[++i]);
+			if (repeats < 1)
+				repeats = 1;
+			continue;
+		}
+
+		if (!strncmp(argv[i], "-b", 2) && ((i + 1) < argc)) {
+			if (sscanf(argv[++i], "%d-%d", &min_bits, &max_bits) == 2)
+				continue;
+		}
+
+		printf("Usage: %s [-f word-file] [-r repeats] [-b min_bits-max_bits]\n", argv[0]);
+		exit(1);
+	}
+
+	// Load the keys the same way the solvers do, with a single reader
+	ctx->nthreads = 1;
+	if (read_words(file) < 0)
+		exit(EXIT_FAILURE);
+
+	if (ctx->nkeys == 0) {
+		printf("No %d letter words with unique letters found in %s\n", WORD_LEN, file);
+		exit(1);
+	}
+
+	// By default go from the smallest table that's no more than 3/4
+	// full up to 16x that size
+	if (min_bits == 0) {
+		for (min_bits = 1; (ctx->nkeys << 2) > (3 << min_bits); min_bits++);
+		max_bits = min_bits + 4;
+	}
+	if (min_bits < 1)
+		min_bits = 1;
+	if (max_bits > MAX_BITS)
+		max_bits = MAX_BITS;
+
+	printf("%s: %d keys, utilities.h uses HASHBITS = %d\n\n", file, ctx->nkeys, HASHBITS);
+	printf("%-10s %4s %5s %9s %9s %6s %5s   probe length histogram\n",
+		"hash", "bits", "load", "insert ns", "lookup ns", "avg", "max");
+	printf("%-10s %4s %5s %9s %9s %6s %5s   %5s %5s %5s %5s %5s %5s %5s %5s\n",
+		"", "", "", "per key", "per key", "probe", "probe",
+		"0", "1", "2", "3", "4-7", "8-15", "16-31", "32+");
+
+	for (int bits = min_bits; bits <= max_bits; bits++) {
+		// A table has to have room for all the keys
+		if ((1 << bits) <= ctx->nkeys)
+			continue;
+
+		for (uint32_t c = 0; c < NUM_CANDIDATES; c++) {
+			struct result r[1];
+
+			bench(candidates + c, bits, repeats, r);
+
+			printf("%-10s %4d %5.2f %9.2f %9.2f %6.3f %5u  ",
+				candidates[c].name, bits, (double)ctx->nkeys / (1 << bits),
+				(double)r->insert_ns / ctx->nkeys, (double)r->lookup_ns / ctx->nkeys,
+				(double)r->probes / ctx->nkeys, r->max_probe);
+			for (int h = 0; h < PROBE_BUCKETS; h++)
+				printf(" %5u", r->hist[h]);
+			printf("\n");
+		}
+		printf("\n");
+	}
+
+	exit(0);
+} // main
@@ -0,0 +1,1346 @@
+// Solver kernels for the Parker 5x5 Unique Word Problem
+//
+// Author: Stew Forster (stew675@gmail.com)	Date: Aug 2022
+//
+// s25, v25 and 525 share the same tiered search and differ only in how they
+// scan a tier range for keys that are compatible with the current mask.
+// This file holds that search once, and is included after utilities.h with
+// KERNEL_ISA set to one of KERNEL_SCALAR, KERNEL_AVX2 or KERNEL_AVX512.
+//
+// When RUNTIME_DISPATCH is defined it may be included once per instruction
+// set.  Each function then gets an ISA suffix and the matching target
+// attribute, and bind_kernels() picks which set gets used
+
+#ifndef KERNEL_ISA
+#error "KERNEL_ISA must be defined before including kernels.h"
+#endif
+
+#ifndef KERNELS_COMMON
+#define KERNELS_COMMON
+
+// ********************* SOLUTION FUNCTIONS ********************
+
+// Each solution is kept as a SOLUTION_LEN line of text, or as its word indices
+// with WORD_INDEX.  sp points to the NUM_WORDS keys (or key references), and
+// mask has all of their letters.  It goes into a line of the chunk that the
+// NUMA node that f is in has for it.  The first solution of each chunk claims
+// the chunk's lines, and any others that land in it meanwhile wait on that
+static void
+add_solution(struct frequency *f, uint32_t mask, uint32_t *sp)
+{
+	// A solution that skipped a required letter doesn't count
+	if (ctx->required & ~mask)
+		return;
+
+	uint32_t n = atomic_fetch_add(&ctx->node_sol[f->node].n, 1);
+	uint32_t c = n / SOL_CHUNK;
+
+	if (c >= SOL_CHUNKS)
+		return;
+
+	atomic_int *cp = &ctx->node_sol[f->node].chunk[c];
+	int base;
+
+	if ((n % SOL_CHUNK) == 0) {
+		base = atomic_fetch_add(&ctx->sol_next, SOL_CHUNK);
+		handoff_store(cp, ((base < MAX_SOLUTIONS) ? base : MAX_SOLUTIONS) + 1);
+	}
+	if ((base = atomic_load(cp)) == 0)
+		base = wait_change(cp, 0);
+
+	n = (base - 1) + (n % SOL_CHUNK);
+	if (n >= MAX_SOLUTIONS)
+		return;
+
+#ifdef WORD_INDEX
+	for (int i = 0; i < NUM_WORDS; i++)
+		ctx->solidx[n][i] = ctx->tidx[sp[i]];
+#else
+	const char *wp[NUM_WORDS];
+
+	for (int i = 0; i < NUM_WORDS; i++)
+		wp[i] = word_lookup(sp[i]);
+	format_solution(ctx->solutions + (n << SOLUTION_SHIFT), wp);
+#endif
+} // add_solution
+
+// ********************* SEARCH STATS ********************
+
+// With SEARCH_STATS, each finder call is counted by how many skips it has
+// left and its depth, which is how many words it has been given.  Each tier
+// range scanned is counted with how many keys it had, and how many of them
+// were compatible with the mask
+#ifdef SEARCH_STATS
+static inline void
+stats_scan(struct frequency *f, uint32_t mask, uint32_t len, uint32_t n)
+{
+	int depth = __builtin_popcount(mask) / WORD_LEN;
+
+	stats->scans[depth]++;
+	stats->scanned[depth] += len;
+	stats->matched[depth] += n;
+	stats->empty[depth] += !n;
+	stats->set_scans[f->b][depth]++;
+} // stats_scan
+#endif
+
+// ********************* WORK STEALING ********************
+
+// The top level keys have search trees of very different sizes, so that
+// handing them out one at a time leaves most solvers idle at the end while
+// a few finish their last big ones.  So each solver splits the search below
+// a top level key into tasks of STEAL_CHUNK depth 2 subtrees on its own
+// Chase-Lev deque.  It pushes and pops them at the bottom, and solvers that
+// have run out of top level keys steal them from the top.  The deque never
+// needs to grow, as a task that doesn't fit gets run straight away
+
+// Copies tk onto the bottom of the deque.  Returns 0 if it's full
+static inline int
+deque_push(struct deque *dq, struct task *tk)
+{
+	int b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+	int t = atomic_load_explicit(&dq->top, memory_order_acquire);
+
+	if ((b - t) >= DEQUE_SIZE)
+		return 0;
+
+	dq->tasks[b & (DEQUE_SIZE - 1)] = *tk;
+	atomic_store_explicit(&dq->bottom, b + 1, memory_order_release);
+	return 1;
+} // deque_push
+
+// Takes the task at the bottom of the deque, or returns NULL if there are
+// none left.  Only the owner pushes, so the task stays put while it runs
+static inline struct task *
+deque_pop(struct deque *dq)
+{
+	int b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+
+	atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	int t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+	if (t > b) {
+		atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+		return NULL;
+	}
+
+	struct task *tk = dq->tasks + (b & (DEQUE_SIZE - 1));
+
+	// The last task may be being stolen at the same time
+	if (t == b) {
+		if (!atomic_compare_exchange_strong(&dq->top, &t, t + 1))
+			tk = NULL;
+		atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+	}
+	return tk;
+} // deque_pop
+
+// Copies the task at the top of another solver's deque into tk.  Returns 0
+// if there was none, or if another thief or the owner got it first
+static inline int
+deque_steal(struct deque *dq, struct task *tk)
+{
+	int t = atomic_load_explicit(&dq->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	int b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+
+	if (t >= b)
+		return 0;
+
+	*tk = dq->tasks[t & (DEQUE_SIZE - 1)];
+	return atomic_compare_exchange_strong(&dq->top, &t, t + 1);
+} // deque_steal
+
+// ********************* BREADTH FIRST ENGINE ********************
+
+// With -e bfs, each task's search is expanded a level at a time, rather
+// than depth first.  All the nodes of a level that scan the same tier subset
+// next are scanned together, so that each block of keys is loaded once for
+// all of their masks.  A level is expanded BFS_NODES nodes at a time, so
+// that the whole frontier fits on the stack, and the nodes that skip a
+// letter are expanded at the same level, after the rest of it
+
+#define BFS_NODES	256
+
+// A partial solution.  Its words are found by following parent back up to
+// the keys of the task that it's from
+struct bnode {
+	struct bnode	*parent;	// NULL for the keys of the task
+	struct frequency *f;		// Set its last word was taken or skipped from
+	uint32_t	mask;		// Letters of its words
+	uint32_t	ref;		// Key ref of its last word
+	uint32_t	skips;		// Skips left
+};
+
+// Adds the solution that nd completes to those of task tk
+static void
+bfs_solution(struct task *tk, struct bnode *nd)
+{
+	uint32_t solution[NUM_WORDS], mask = nd->mask;
+
+	memcpy(solution, tk->prefix, sizeof(*solution) * tk->depth);
+	for (int d = NUM_WORDS; nd; nd = nd->parent)
+		solution[--d] = nd->ref;
+
+	add_solution(tk->f, mask, solution);
+} // bfs_solution
+
+// ********************* BITMAP ENGINE ********************
+
+// With -e bitmap, all of the keys are laid out in bkeys in frequency set
+// order, and each key gets a bitmap of the keys of the later sets that have
+// none of its letters.  The solvers build those together before searching.
+// The search keeps a bitmap of the keys compatible with every word so far,
+// and takes the next word from the bits in the next set's range.  The
+// bitmap for the level below is that ANDed with the word's own, over just
+// the later sets, and the last word of a solution needs no AND at all
+
+#define BITMAP_CHUNK	64	// Bitmaps that a solver builds at a time
+
+// Lays the keys out in frequency set order, followed by keys with every
+// bit set, as they're never compatible.  The bitmaps are packed, as each
+// only needs the words from the one that the next set starts in
+static void
+bitmap_layout()
+{
+	uint32_t n = 0, nw;
+
+	for (int i = 0; i < 26; i++) {
+		struct frequency *f = ctx->frq + i;
+		struct tier *t = f->sets;
+
+		ctx->bbase[i] = n;
+		for (uint32_t pos = 0; pos < t->l; pos++, n++) {
+			ctx->bkeys[n] = t->s[pos];
+			ctx->brefs[n] = key_ref(f, t->s + pos);
+		}
+	}
+	ctx->bbase[26] = n;
+
+	for (int p = 0; p < 64; p++)
+		ctx->bkeys[n + p] = (uint32_t)(~0);
+
+	nw = (n + 63) >> 6;
+	ctx->bwords = 0;
+	for (int i = 0; i < 26; i++)
+		for (uint32_t k = ctx->bbase[i]; k < ctx->bbase[i + 1]; k++) {
+			ctx->boff[k] = ctx->bwords;
+			ctx->bwords += nw - (ctx->bbase[i + 1] >> 6);
+		}
+} // bitmap_layout
+
+// Clears the bits of bitmap word w that are for keys outside of [lo, hi)
+static inline uint64_t
+bitmap_clip(uint64_t bits, uint32_t w, uint32_t lo, uint32_t hi)
+{
+	if ((w << 6) < lo)
+		bits &= ~0ULL << (lo & 63);
+	if (((w + 1) << 6) > hi)
+		bits &= ~(~0ULL << (hi & 63));
+	return bits;
+} // bitmap_clip
+
+// Returns the frequency set that key k of the layout is in
+static inline int
+bitmap_set(uint32_t k)
+{
+	int i = 0;
+
+	while (k >= ctx->bbase[i + 1])
+		i++;
+	return i;
+} // bitmap_set
+
+// ********************* MEET IN THE MIDDLE ENGINE ********************
+
+// With -e mitm, the solvers only search for the first NUM_WORDS - 2 words.
+// The last two are then looked up together, by the letters that are left,
+// in a hash table of the disjoint pairs of keys.  Both keys of a pair come
+// from sets after that of the prefix's last word, so any letters before
+// it that the prefix didn't use must be among those skipped.
+//
+// The pairs are built over the bitmap engine's key layout, with each key
+// paired with the compatible keys of the later sets.  They're partitioned
+// by their first key, so that no more than MITM_PAIRS are held at once.
+// The solvers build each partition together, and then join it with every
+// prefix that could use it, before moving on to the next one
+
+#define MITM_CHUNK	64	// Keys that a solver counts or pairs at a time
+
+// A partition of the pairs, whose first keys are from sets first to last
+struct mpass {
+	uint32_t	tag;		// Marks its hash chains
+	uint32_t	before;		// Letters of the sets before first
+	uint32_t	upto;		// Letters of the sets up to last
+	int		last;
+};
+
+static inline uint32_t
+mitm_hash(uint32_t mask)
+{
+	return (mask * 0x9E3779B1) >> (31 - MITM_BITS);
+} // mitm_hash
+
+// Claims up to n of the work items that are left before end.  Returns how
+// many were, with the first in *first
+static inline uint32_t
+mitm_claim(uint32_t end, uint32_t n, uint32_t *first)
+{
+	int cur = atomic_load(&ctx->mitm_next);
+
+	do {
+		if (cur >= (int)end)
+			return 0;
+		if (n > (end - cur))
+			n = end - cur;
+	} while (!atomic_compare_exchange_weak(&ctx->mitm_next, &cur, cur + n));
+
+	*first = cur;
+	return n;
+} // mitm_claim
+
+// Returns the key after the last of the partition that starts with key ka,
+// which has as many keys' pairs as fit
+static inline uint32_t
+mitm_partition(uint32_t ka, uint32_t nk)
+{
+	uint32_t kb = ka + 1;
+
+	while ((kb < nk) && ((ctx->moff[kb + 1] - ctx->moff[ka]) <= MITM_PAIRS))
+		kb++;
+	return kb;
+} // mitm_partition
+
+// Adds a solution for each pair with just the letters in pm
+static void
+mitm_lookup(struct frequency *frq, uint32_t mask, uint32_t pm, uint32_t *sp, struct mpass *mp)
+{
+	// The first key of the pair would be from a set of another partition
+	if ((pm & mp->before) || !(pm & mp->upto))
+		return;
+
+	uint64_t head = ctx->mheads[mitm_hash(pm)];
+
+	// The chain is left over from an earlier partition
+	if ((head >> 32) != mp->tag)
+		return;
+
+	for (uint32_t s = (uint32_t)head; s != MITM_NONE; s = ctx->mpairs[s].next) {
+		struct mpair *p = ctx->mpairs + s;
+
+		if (p->mask != pm)
+			continue;
+		sp[1] = p->refs[0];
+		sp[2] = p->refs[1];
+		add_solution(frq, mask | pm, sp + 2 - (NUM_WORDS - 1));
+	}
+} // mitm_lookup
+
+// Takes need more of the free letters out of pm as skipped, and looks up
+// the pairs for each way of doing so
+static void
+mitm_probe(struct frequency *frq, uint32_t mask, uint32_t pm, uint32_t free, int need,
+	   uint32_t *sp, struct mpass *mp)
+{
+	if (need == 0)
+		return mitm_lookup(frq, mask, pm, sp, mp);
+
+	for (uint32_t rest = free, b; rest; ) {
+		b = rest & -rest;
+		rest ^= b;
+		mitm_probe(frq, mask, pm ^ b, rest, need - 1, sp, mp);
+	}
+} // mitm_probe
+
+// Joins the prefix in mask, whose last word sp came from set fi, with the
+// pairs of the partition
+static void
+mitm_join(struct frequency *frq, int fi, uint32_t mask, uint32_t *sp, struct mpass *mp)
+{
+	uint32_t left = ~mask & ((1 << 26) - 1);
+	uint32_t forced = left & ctx->mbelow[fi];
+	int need = __builtin_popcount(left) - (WORD_LEN * 2) - __builtin_popcount(forced);
+
+	if ((need < 0) || (forced & ctx->required))
+		return;
+
+	mitm_probe(frq, mask, left ^ forced, left & ~(forced | ctx->required), need, sp, mp);
+} // mitm_join
+
+#endif
+
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef GET_TIER
+
+#ifdef RUNTIME_DISPATCH
+#if KERNEL_ISA == KERNEL_AVX512
+#define KERNEL(name)	name##_avx512
+#define KERNEL_TARGET	__attribute__((target("avx512f,avx512bw,avx2,bmi,bmi2,lzcnt,popcnt")))
+#elif KERNEL_ISA == KERNEL_AVX2
+#define KERNEL(name)	name##_avx2
+#define KERNEL_TARGET	__attribute__((target("avx2,bmi,bmi2,lzcnt,popcnt")))
+#else
+#define KERNEL(name)	name##_scalar
+#define KERNEL_TARGET
+#endif
+#else
+#define KERNEL(name)	name
+#define KERNEL_TARGET
+#endif
+
+// The AVX kernels always have pext available to them
+#if (KERNEL_ISA != KERNEL_SCALAR) || defined(_USE_PEXT_U32_)
+#define GET_TIER GET_TIER_PEXT
+#else
+#define GET_TIER GET_TIER_SCALAR
+#endif
+
+// ********************* SOLVER ALGORITHM ********************
+
+// Each kernel first compacts the keys in [set, end) that are compatible with
+// mask into ks, and with WORD_INDEX their key refs into kr, counting them in
+// n.  Only then does it recurse on each, so that the scan itself has no
+// branches on which keys matched.  No tier range can be longer than all of
+// the keys, and the AVX kernels store whole vectors at ks + n, so ks has room
+// for MAX_WORDS and one more vector past the last key.  Only the part that's
+// used gets touched, so most finders only ever use a few cache lines of it
+
+#define SCAN_KEYS	(MAX_WORDS + 16)
+
+#if KERNEL_ISA == KERNEL_AVX512
+
+// The keys are compressed in a register and then all 16 are stored.  That's
+// as fast as a compress store on Intel, which is microcoded on AMD Zen 4
+#ifdef WORD_INDEX
+#define COMPACT_KEYS							\
+	__m512i vmask = _mm512_set1_epi32(mask);			\
+	__m512i vref = _mm512_add_epi32(_mm512_set1_epi32(key_ref(f, set)),	\
+		_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));	\
+									\
+	for (; set < end; set += 16) {					\
+		__m512i vkeys = _mm512_loadu_si512((__m512i *)set);	\
+		__mmask16 m = _mm512_testn_epi32_mask(vkeys, vmask);	\
+									\
+		_mm512_storeu_si512((__m512i *)(ks + n), _mm512_maskz_compress_epi32(m, vkeys));	\
+		_mm512_storeu_si512((__m512i *)(kr + n), _mm512_maskz_compress_epi32(m, vref));	\
+		vref = _mm512_add_epi32(vref, _mm512_set1_epi32(16));	\
+		n += __builtin_popcount(m);				\
+	}
+#else
+#define COMPACT_KEYS							\
+	__m512i vmask = _mm512_set1_epi32(mask);			\
+									\
+	for (; set < end; set += 16) {					\
+		__m512i vkeys = _mm512_loadu_si512((__m512i *)set);	\
+		__mmask16 m = _mm512_testn_epi32_mask(vkeys, vmask);	\
+									\
+		_mm512_storeu_si512((__m512i *)(ks + n), _mm512_maskz_compress_epi32(m, vkeys));	\
+		n += __builtin_popcount(m);				\
+	}
+#endif
+
+#elif KERNEL_ISA == KERNEL_AVX2
+
+// AVX2 has no compress, so permutevar8x32 does it instead.  Entry m has the
+// positions of the set bits of m, one per byte, lowest first
+static const uint64_t compress_lut[256] = {
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000100ULL,
+	0x0000000000000002ULL, 0x0000000000000200ULL, 0x0000000000000201ULL, 0x0000000000020100ULL,
+	0x0000000000000003ULL, 0x0000000000000300ULL, 0x0000000000000301ULL, 0x0000000000030100ULL,
+	0x0000000000000302ULL, 0x0000000000030200ULL, 0x0000000000030201ULL, 0x0000000003020100ULL,
+	0x0000000000000004ULL, 0x0000000000000400ULL, 0x0000000000000401ULL, 0x0000000000040100ULL,
+	0x0000000000000402ULL, 0x0000000000040200ULL, 0x0000000000040201ULL, 0x0000000004020100ULL,
+	0x0000000000000403ULL, 0x0000000000040300ULL, 0x0000000000040301ULL, 0x0000000004030100ULL,
+	0x0000000000040302ULL, 0x0000000004030200ULL, 0x0000000004030201ULL, 0x0000000403020100ULL,
+	0x0000000000000005ULL, 0x0000000000000500ULL, 0x0000000000000501ULL, 0x0000000000050100ULL,
+	0x0000000000000502ULL, 0x0000000000050200ULL, 0x0000000000050201ULL, 0x0000000005020100ULL,
+	0x0000000000000503ULL, 0x0000000000050300ULL, 0x0000000000050301ULL, 0x0000000005030100ULL,
+	0x0000000000050302ULL, 0x0000000005030200ULL, 0x0000000005030201ULL, 0x0000000503020100ULL,
+	0x0000000000000504ULL, 0x0000000000050400ULL, 0x0000000000050401ULL, 0x0000000005040100ULL,
+	0x0000000000050402ULL, 0x0000000005040200ULL, 0x0000000005040201ULL, 0x0000000504020100ULL,
+	0x0000000000050403ULL, 0x0000000005040300ULL, 0x0000000005040301ULL, 0x0000000504030100ULL,
+	0x0000000005040302ULL, 0x0000000504030200ULL, 0x0000000504030201ULL, 0x0000050403020100ULL,
+	0x0000000000000006ULL, 0x0000000000000600ULL, 0x0000000000000601ULL, 0x0000000000060100ULL,
+	0x0000000000000602ULL, 0x0000000000060200ULL, 0x0000000000060201ULL, 0x0000000006020100ULL,
+	0x0000000000000603ULL, 0x0000000000060300ULL, 0x0000000000060301ULL, 0x0000000006030100ULL,
+	0x0000000000060302ULL, 0x0000000006030200ULL, 0x0000000006030201ULL, 0x0000000603020100ULL,
+	0x0000000000000604ULL, 0x0000000000060400ULL, 0x0000000000060401ULL, 0x0000000006040100ULL,
+	0x0000000000060402ULL, 0x0000000006040200ULL, 0x0000000006040201ULL, 0x0000000604020100ULL,
+	0x0000000000060403ULL, 0x0000000006040300ULL, 0x0000000006040301ULL, 0x0000000604030100ULL,
+	0x0000000006040302ULL, 0x0000000604030200ULL, 0x0000000604030201ULL, 0x0000060403020100ULL,
+	0x0000000000000605ULL, 0x0000000000060500ULL, 0x0000000000060501ULL, 0x0000000006050100ULL,
+	0x0000000000060502ULL, 0x0000000006050200ULL, 0x0000000006050201ULL, 0x0000000605020100ULL,
+	0x0000000000060503ULL, 0x0000000006050300ULL, 0x0000000006050301ULL, 0x0000000605030100ULL,
+	0x0000000006050302ULL, 0x0000000605030200ULL, 0x0000000605030201ULL, 0x0000060503020100ULL,
+	0x0000000000060504ULL, 0x0000000006050400ULL, 0x0000000006050401ULL, 0x0000000605040100ULL,
+	0x0000000006050402ULL, 0x0000000605040200ULL, 0x0000000605040201ULL, 0x0000060504020100ULL,
+	0x0000000006050403ULL, 0x0000000605040300ULL, 0x0000000605040301ULL, 0x0000060504030100ULL,
+	0x0000000605040302ULL, 0x0000060504030200ULL, 0x0000060504030201ULL, 0x0006050403020100ULL,
+	0x0000000000000007ULL, 0x0000000000000700ULL, 0x0000000000000701ULL, 0x0000000000070100ULL,
+	0x0000000000000702ULL, 0x0000000000070200ULL, 0x0000000000070201ULL, 0x0000000007020100ULL,
+	0x0000000000000703ULL, 0x0000000000070300ULL, 0x0000000000070301ULL, 0x0000000007030100ULL,
+	0x0000000000070302ULL, 0x0000000007030200ULL, 0x0000000007030201ULL, 0x0000000703020100ULL,
+	0x0000000000000704ULL, 0x0000000000070400ULL, 0x0000000000070401ULL, 0x0000000007040100ULL,
+	0x0000000000070402ULL, 0x0000000007040200ULL, 0x0000000007040201ULL, 0x0000000704020100ULL,
+	0x0000000000070403ULL, 0x0000000007040300ULL, 0x0000000007040301ULL, 0x0000000704030100ULL,
+	0x0000000007040302ULL, 0x0000000704030200ULL, 0x0000000704030201ULL, 0x0000070403020100ULL,
+	0x0000000000000705ULL, 0x0000000000070500ULL, 0x0000000000070501ULL, 0x0000000007050100ULL,
+	0x0000000000070502ULL, 0x0000000007050200ULL, 0x0000000007050201ULL, 0x0000000705020100ULL,
+	0x0000000000070503ULL, 0x0000000007050300ULL, 0x0000000007050301ULL, 0x0000000705030100ULL,
+	0x0000000007050302ULL, 0x0000000705030200ULL, 0x0000000705030201ULL, 0x0000070503020100ULL,
+	0x0000000000070504ULL, 0x0000000007050400ULL, 0x0000000007050401ULL, 0x0000000705040100ULL,
+	0x0000000007050402ULL, 0x0000000705040200ULL, 0x0000000705040201ULL, 0x0000070504020100ULL,
+	0x0000000007050403ULL, 0x0000000705040300ULL, 0x0000000705040301ULL, 0x0000070504030100ULL,
+	0x0000000705040302ULL, 0x0000070504030200ULL, 0x0000070504030201ULL, 0x0007050403020100ULL,
+	0x0000000000000706ULL, 0x0000000000070600ULL, 0x0000000000070601ULL, 0x0000000007060100ULL,
+	0x0000000000070602ULL, 0x0000000007060200ULL, 0x0000000007060201ULL, 0x0000000706020100ULL,
+	0x0000000000070603ULL, 0x0000000007060300ULL, 0x0000000007060301ULL, 0x0000000706030100ULL,
+	0x0000000007060302ULL, 0x0000000706030200ULL, 0x0000000706030201ULL, 0x0000070603020100ULL,
+	0x0000000000070604ULL, 0x0000000007060400ULL, 0x0000000007060401ULL, 0x0000000706040100ULL,
+	0x0000000007060402ULL, 0x0000000706040200ULL, 0x0000000706040201ULL, 0x0000070604020100ULL,
+	0x0000000007060403ULL, 0x0000000706040300ULL, 0x0000000706040301ULL, 0x0000070604030100ULL,
+	0x0000000706040302ULL, 0x0000070604030200ULL, 0x0000070604030201ULL, 0x0007060403020100ULL,
+	0x0000000000070605ULL, 0x0000000007060500ULL, 0x0000000007060501ULL, 0x0000000706050100ULL,
+	0x0000000007060502ULL, 0x0000000706050200ULL, 0x0000000706050201ULL, 0x0000070605020100ULL,
+	0x0000000007060503ULL, 0x0000000706050300ULL, 0x0000000706050301ULL, 0x0000070605030100ULL,
+	0x0000000706050302ULL, 0x0000070605030200ULL, 0x0000070605030201ULL, 0x0007060503020100ULL,
+	0x0000000007060504ULL, 0x0000000706050400ULL, 0x0000000706050401ULL, 0x0000070605040100ULL,
+	0x0000000706050402ULL, 0x0000070605040200ULL, 0x0000070605040201ULL, 0x0007060504020100ULL,
+	0x0000000706050403ULL, 0x0000070605040300ULL, 0x0000070605040301ULL, 0x0007060504030100ULL,
+	0x0000070605040302ULL, 0x0007060504030200ULL, 0x0007060504030201ULL, 0x0706050403020100ULL,
+};
+
+#define COMPRESS_PERM(m)	_mm256_cvtepu8_epi32(_mm_cvtsi64_si128(compress_lut[m]))
+
+#ifdef WORD_INDEX
+#define COMPACT_KEYS							\
+	__m256i vmask = _mm256_set1_epi32(mask);			\
+	__m256i vref = _mm256_add_epi32(_mm256_set1_epi32(key_ref(f, set)),	\
+					_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));	\
+									\
+	for (; set < end; set += 8) {					\
+		__m256i vkeys = _mm256_loadu_si256((__m256i *)set);	\
+		__m256i vres = _mm256_cmpeq_epi32(_mm256_and_si256(vmask, vkeys), _mm256_setzero_si256());	\
+		uint32_t m = _mm256_movemask_ps(_mm256_castsi256_ps(vres));	\
+		__m256i vperm = COMPRESS_PERM(m);			\
+									\
+		_mm256_storeu_si256((__m256i *)(ks + n), _mm256_permutevar8x32_epi32(vkeys, vperm));	\
+		_mm256_storeu_si256((__m256i *)(kr + n), _mm256_permutevar8x32_epi32(vref, vperm));	\
+		vref = _mm256_add_epi32(vref, _mm256_set1_epi32(8));	\
+		n += __builtin_popcount(m);				\
+	}
+#else
+#define COMPACT_KEYS							\
+	__m256i vmask = _mm256_set1_epi32(mask);			\
+									\
+	for (; set < end; set += 8) {					\
+		__m256i vkeys = _mm256_loadu_si256((__m256i *)set);	\
+		__m256i vres = _mm256_cmpeq_epi32(_mm256_and_si256(vmask, vkeys), _mm256_setzero_si256());	\
+		uint32_t m = _mm256_movemask_ps(_mm256_castsi256_ps(vres));	\
+									\
+		_mm256_storeu_si256((__m256i *)(ks + n), _mm256_permutevar8x32_epi32(vkeys, COMPRESS_PERM(m)));	\
+		n += __builtin_popcount(m);				\
+	}
+#endif
+
+#else
+
+#ifdef WORD_INDEX
+#define COMPACT_KEYS							\
+	for (; set < end; set++) {					\
+		ks[n] = *set;						\
+		kr[n] = key_ref(f, set);				\
+		n += !(*set & mask);					\
+	}
+#else
+#define COMPACT_KEYS							\
+	for (; set < end; set++) {					\
+		ks[n] = *set;						\
+		n += !(*set & mask);					\
+	}
+#endif
+
+#endif
+
+// Calls FN(f, mask | key, sp) for every key in [set, end) that is
+// compatible with mask, after having recorded that key at *sp
+#ifdef WORD_INDEX
+#define SCAN_AND_RECURSE(FN)						\
+	uint32_t ks[SCAN_KEYS] __attribute__((aligned(64)));		\
+	uint32_t kr[SCAN_KEYS] __attribute__((aligned(64)));		\
+	uint32_t n = 0;							\
+	SEARCH_STAT(uint32_t len = end - set;)				\
+									\
+	COMPACT_KEYS;							\
+	SEARCH_STAT(stats_scan(f, mask, len, n);)			\
+									\
+	for (uint32_t i = (sp++, 0); i < n; i++) {			\
+		*sp = kr[i];						\
+		FN(f, mask | ks[i], sp);				\
+	}
+#else
+#define SCAN_AND_RECURSE(FN)						\
+	uint32_t ks[SCAN_KEYS] __attribute__((aligned(64)));		\
+	uint32_t key, *kp, n = 0;					\
+	SEARCH_STAT(uint32_t len = end - set;)				\
+									\
+	COMPACT_KEYS;							\
+	SEARCH_STAT(stats_scan(f, mask, len, n);)			\
+									\
+	for (sp++, ks[n] = 0, kp = ks; (*sp = key = *kp++); )		\
+		FN(f,  mask | key, sp);
+#endif
+
+// Defines finder FN, which places a key from the set of the least frequent
+// letter not yet in mask.  SKIP is what to do after that, and is how letters
+// get skipped.  Each finder that may still skip a letter hands off to the
+// finder with one skip fewer, until find_skipped() which may skip no more.
+// SKIPS is how many skips it has left
+#define DEFINE_FINDER(FN, SKIPS, SKIP)					\
+static KERNEL_TARGET void						\
+KERNEL(FN)(struct frequency *f, uint32_t mask, uint32_t *sp)		\
+{									\
+	uint32_t *set, *end;						\
+									\
+	SEARCH_STAT(stats->calls[SKIPS][__builtin_popcount(mask) / WORD_LEN]++;)	\
+	if (__builtin_popcount(mask) == COVER_LETTERS)			\
+		return add_solution(f, mask, sp - (NUM_WORDS - 1));	\
+									\
+	while (mask & (++f)->m);					\
+									\
+	CALCULATE_SET_AND_END;						\
+									\
+	SCAN_AND_RECURSE(KERNEL(FN));					\
+									\
+	SKIP								\
+}
+
+DEFINE_FINDER(find_skipped, 0, )
+
+#if NUM_SKIPS > 1
+DEFINE_FINDER(find_skipped_1, 1, KERNEL(find_skipped)(f, mask, sp - 1);)
+#endif
+#if NUM_SKIPS > 2
+DEFINE_FINDER(find_skipped_2, 2, KERNEL(find_skipped_1)(f, mask, sp - 1);)
+#endif
+#if NUM_SKIPS > 3
+DEFINE_FINDER(find_skipped_3, 3, KERNEL(find_skipped_2)(f, mask, sp - 1);)
+#endif
+#if NUM_SKIPS > 4
+DEFINE_FINDER(find_skipped_4, 4, KERNEL(find_skipped_3)(f, mask, sp - 1);)
+#endif
+#if NUM_SKIPS > 5
+DEFINE_FINDER(find_skipped_5, 5, KERNEL(find_skipped_4)(f, mask, sp - 1);)
+#endif
+
+// find_solutions() which is the busiest loop is kept
+// as small and tight as possible for the most speed
+#if NUM_SKIPS == 1
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped)(f, mask, sp - 1);)
+#elif NUM_SKIPS == 2
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped_1)(f, mask, sp - 1);)
+#elif NUM_SKIPS == 3
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped_2)(f, mask, sp - 1);)
+#elif NUM_SKIPS == 4
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped_3)(f, mask, sp - 1);)
+#elif NUM_SKIPS == 5
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped_4)(f, mask, sp - 1);)
+#elif NUM_SKIPS == 6
+DEFINE_FINDER(find_solutions, NUM_SKIPS, KERNEL(find_skipped_5)(f, mask, sp - 1);)
+#endif
+
+#undef DEFINE_FINDER
+#undef SCAN_AND_RECURSE
+#undef COMPACT_KEYS
+
+// The finders by how many more letters they may skip
+static void (*const KERNEL(finders)[NUM_SKIPS + 1])(struct frequency *, uint32_t, uint32_t *) = {
+	KERNEL(find_skipped),
+#if NUM_SKIPS > 1
+	KERNEL(find_skipped_1),
+#endif
+#if NUM_SKIPS > 2
+	KERNEL(find_skipped_2),
+#endif
+#if NUM_SKIPS > 3
+	KERNEL(find_skipped_3),
+#endif
+#if NUM_SKIPS > 4
+	KERNEL(find_skipped_4),
+#endif
+#if NUM_SKIPS > 5
+	KERNEL(find_skipped_5),
+#endif
+#if NUM_SKIPS > 0
+	KERNEL(find_solutions),
+#endif
+};
+
+// BATCH_MATCH(m) has a bit for each of the BATCH_KEYS keys loaded by
+// BATCH_LOAD() that are compatible with m
+#if KERNEL_ISA == KERNEL_AVX512
+#define BATCH_KEYS	16
+#define BATCH_LOAD(kp)	__m512i vkeys = _mm512_loadu_si512((__m512i *)(kp))
+#define BATCH_MATCH(m)	((uint32_t)_mm512_testn_epi32_mask(vkeys, _mm512_set1_epi32(m)))
+#elif KERNEL_ISA == KERNEL_AVX2
+#define BATCH_KEYS	8
+#define BATCH_LOAD(kp)	__m256i vkeys = _mm256_loadu_si256((__m256i *)(kp))
+#define BATCH_MATCH(m)	((uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(		\
+				_mm256_cmpeq_epi32(_mm256_and_si256(vkeys, _mm256_set1_epi32(m)),	\
+						   _mm256_setzero_si256()))))
+#else
+#define BATCH_KEYS	1
+#define BATCH_LOAD(kp)	uint32_t vkeys = *(kp)
+#define BATCH_MATCH(m)	((uint32_t)!(vkeys & (m)))
+#endif
+
+// Expands the n nodes of task tk that have depth words by one more word.
+// Nodes that scan the same tier subset scan it together, over the union of
+// their windows.  That's safe as the keys outside a node's own window all
+// have a window letter that's in its mask
+static KERNEL_TARGET void
+KERNEL(bfs_expand)(struct task *tk, struct bnode *in, uint32_t n, uint32_t depth)
+{
+	struct bnode	out[BFS_NODES], skipped[2][BFS_NODES], *nd;
+	struct frequency *next[BFS_NODES];
+	uint32_t	*from[BFS_NODES], *to[BFS_NODES];
+	uint32_t	masks[BFS_NODES];
+	uint16_t	group[BFS_NODES], order[BFS_NODES], groups[BFS_NODES];
+	uint16_t	count[26 * NUM_TIERS];
+	uint32_t	nout = 0;
+
+	if (depth == NUM_WORDS) {
+		for (uint32_t i = 0; i < n; i++)
+			bfs_solution(tk, in + i);
+		return;
+	}
+
+	memset(count, 0, sizeof(count));
+
+	for (int round = 0; n; round ^= 1) {
+		uint32_t nskipped = 0, ngroups = 0;
+
+		// Find the tier subset that each node scans next, and group
+		// the nodes by it.  Any that may skip that letter instead are
+		// set aside for the next round
+		for (uint32_t i = 0; i < n; i++) {
+			struct frequency *f = in[i].f;
+			uint32_t mask = in[i].mask, *set, *end, g;
+
+			while (mask & (++f)->m);
+
+			GET_TIER;
+			g = ((f - tk->f) * NUM_TIERS) + (t - f->sets);
+			if (count[g]++ == 0)
+				groups[ngroups++] = g;
+			group[i] = g;
+
+			CALCULATE_SET_AND_END;
+			next[i] = f;
+			from[i] = set;
+			to[i] = end;
+
+			if (in[i].skips) {
+				nd = skipped[round] + nskipped++;
+				*nd = in[i];
+				nd->f = f;
+				nd->skips--;
+			}
+		}
+
+		// Counting sort of the nodes by group, after which count[g]
+		// is where group g ends in order
+		for (uint32_t j = 0, pos = 0; j < ngroups; j++) {
+			uint32_t c = count[groups[j]];
+
+			count[groups[j]] = pos;
+			pos += c;
+		}
+		for (uint32_t i = 0; i < n; i++)
+			order[count[group[i]]++] = i;
+
+		for (uint32_t j = 0, first = 0, last; j < ngroups; j++, first = last) {
+			struct frequency *f = next[order[first]];
+			uint32_t *set = from[order[first]], *end = to[order[first]];
+
+			last = count[groups[j]];
+			count[groups[j]] = 0;
+
+			// The masks of the group are gathered together for the scan
+			for (uint32_t k = first; k < last; k++) {
+				masks[k] = in[order[k]].mask;
+				if (from[order[k]] < set)
+					set = from[order[k]];
+				if (to[order[k]] > end)
+					end = to[order[k]];
+			}
+
+			for (; set < end; set += BATCH_KEYS) {
+				BATCH_LOAD(set);
+
+				for (uint32_t k = first; k < last; k++) {
+					for (uint32_t bits = BATCH_MATCH(masks[k]); bits; bits &= bits - 1) {
+						struct bnode *pn = in + order[k];
+						uint32_t *kp = set + __builtin_ctz(bits);
+
+						nd = out + nout++;
+						nd->parent = pn;
+						nd->f = f;
+						nd->mask = masks[k] | *kp;
+						nd->ref = key_ref(f, kp);
+						nd->skips = pn->skips;
+
+						if (nout == BFS_NODES) {
+							KERNEL(bfs_expand)(tk, out, nout, depth + 1);
+							nout = 0;
+						}
+					}
+				}
+			}
+		}
+
+		if (nout) {
+			KERNEL(bfs_expand)(tk, out, nout, depth + 1);
+			nout = 0;
+		}
+
+		in = skipped[round];
+		n = nskipped;
+	}
+} // bfs_expand
+
+#undef BATCH_KEYS
+#undef BATCH_LOAD
+#undef BATCH_MATCH
+
+// Runs a task with the breadth first engine
+static KERNEL_TARGET void
+KERNEL(bfs_task)(struct task *tk)
+{
+	struct bnode roots[STEAL_CHUNK];
+
+	for (uint32_t i = 0; i < tk->n; i++) {
+		roots[i].parent = NULL;
+		roots[i].f = tk->f;
+		roots[i].mask = tk->mask | tk->keys[i];
+		roots[i].ref = tk->refs[i];
+		roots[i].skips = tk->skips;
+	}
+
+	KERNEL(bfs_expand)(tk, roots, tk->n, tk->depth + 1);
+} // bfs_task
+
+// Returns a bit for each of the 64 keys at kp that has none of the letters
+// of mask
+static inline KERNEL_TARGET uint64_t
+KERNEL(bitmap_bits)(uint32_t mask, uint32_t *kp)
+{
+	uint64_t bits = 0;
+
+#if KERNEL_ISA == KERNEL_AVX512
+	__m512i vmask = _mm512_set1_epi32(mask);
+
+	for (int q = 0; q < 4; q++)
+		bits |= (uint64_t)_mm512_testn_epi32_mask(_mm512_loadu_si512((__m512i *)(kp + (q << 4))),
+							  vmask) << (q << 4);
+#elif KERNEL_ISA == KERNEL_AVX2
+	__m256i vmask = _mm256_set1_epi32(mask);
+
+	for (int q = 0; q < 8; q++) {
+		__m256i vkeys = _mm256_loadu_si256((__m256i *)(kp + (q << 3)));
+		__m256i vres = _mm256_cmpeq_epi32(_mm256_and_si256(vkeys, vmask), _mm256_setzero_si256());
+
+		bits |= (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(vres)) << (q << 3);
+	}
+#else
+	for (int b = 0; b < 64; b++)
+		bits |= (uint64_t)!(kp[b] & mask) << b;
+#endif
+	return bits;
+} // bitmap_bits
+
+// Builds the bitmaps of the n keys from k
+static KERNEL_TARGET void
+KERNEL(bitmap_rows)(uint32_t k, uint32_t n)
+{
+	uint32_t nw = (ctx->bbase[26] + 63) >> 6;
+
+	for (int i = 0; n--; k++) {
+		while (k >= ctx->bbase[i + 1])
+			i++;
+
+		uint64_t *row = ctx->bitmaps + ctx->boff[k];
+		for (uint32_t w = ctx->bbase[i + 1] >> 6; w < nw; w++)
+			*row++ = KERNEL(bitmap_bits)(ctx->bkeys[k], ctx->bkeys + (w << 6));
+	}
+} // bitmap_rows
+
+// Finds the last words of the solutions, which are compatible with both
+// cand and the bitmap row that starts at word from.  Only the few words of
+// the sets that are left are ANDed, rather than the whole bitmap
+static KERNEL_TARGET void
+KERNEL(bitmap_last)(struct frequency *frq, struct frequency *f, uint32_t mask, uint64_t *cand,
+		    uint64_t *row, uint32_t from, uint32_t *sp, uint32_t skips)
+{
+	while (mask & (++f)->m);
+
+	uint32_t i = f - frq, lo = ctx->bbase[i], hi = ctx->bbase[i + 1];
+
+	for (uint32_t w = lo >> 6; (w << 6) < hi; w++) {
+		uint64_t bits = bitmap_clip(cand[w] & row[w - from], w, lo, hi);
+
+		for (; bits; bits &= bits - 1) {
+			uint32_t k = (w << 6) + __builtin_ctzll(bits);
+
+			sp[1] = ctx->brefs[k];
+			add_solution(f, mask | ctx->bkeys[k], sp + 1 - (NUM_WORDS - 1));
+		}
+	}
+
+	if (skips)
+		KERNEL(bitmap_last)(frq, f, mask, cand, row, from, sp, skips - 1);
+} // bitmap_last
+
+// Finds the words that can follow mask, where cand has the keys that are
+// compatible with it from the set after f on.  sp is the last word placed
+static KERNEL_TARGET void
+KERNEL(bitmap_find)(struct frequency *frq, struct frequency *f, uint32_t mask,
+		    uint64_t *cand, uint32_t *sp, uint32_t skips)
+{
+	uint64_t next[BITMAP_WORDS] __attribute__((aligned(64)));
+
+	if (__builtin_popcount(mask) == COVER_LETTERS)
+		return add_solution(f, mask, sp - (NUM_WORDS - 1));
+
+	while (mask & (++f)->m);
+
+	uint32_t i = f - frq, lo = ctx->bbase[i], hi = ctx->bbase[i + 1];
+	uint32_t from = hi >> 6, nw = (ctx->bbase[26] + 63) >> 6;
+	int left = (COVER_LETTERS - __builtin_popcount(mask)) / WORD_LEN;
+
+	for (uint32_t w = lo >> 6; (w << 6) < hi; w++) {
+		uint64_t bits = bitmap_clip(cand[w], w, lo, hi);
+
+		for (; bits; bits &= bits - 1) {
+			uint32_t k = (w << 6) + __builtin_ctzll(bits);
+			uint64_t *row = ctx->bitmaps + ctx->boff[k];
+
+			sp[1] = ctx->brefs[k];
+			if (left == 1) {
+				add_solution(f, mask | ctx->bkeys[k], sp + 1 - (NUM_WORDS - 1));
+				continue;
+			}
+			if (left == 2) {
+				KERNEL(bitmap_last)(frq, f, mask | ctx->bkeys[k], cand, row, from, sp + 1, skips);
+				continue;
+			}
+
+			for (uint32_t x = from; x < nw; x++)
+				next[x] = cand[x] & row[x - from];
+			KERNEL(bitmap_find)(frq, f, mask | ctx->bkeys[k], next, sp + 1, skips);
+		}
+	}
+
+	if (skips)
+		KERNEL(bitmap_find)(frq, f, mask, cand, sp, skips - 1);
+} // bitmap_find
+
+// The bitmap engine's part of solve_work().  Solver sn first helps to build
+// the bitmaps, and then takes the top level keys as the finders would
+static KERNEL_TARGET void
+KERNEL(bitmap_work)(struct frequency *frq, int sn, uint32_t *solution, uint32_t mask)
+{
+	uint64_t cand[BITMAP_WORDS] __attribute__((aligned(64)));
+	uint64_t next[BITMAP_WORDS] __attribute__((aligned(64)));
+	uint32_t *sp = solution + ctx->nseeds, n, nw, k;
+	uint64_t t1 = get_ns();
+	int32_t pos;
+
+	if (sn == 0) {
+		bitmap_layout();
+		handoff_store(&ctx->bitmap_ready, 1);
+	} else
+		wait_for(&ctx->bitmap_ready, 1);
+
+	n = ctx->bbase[26];
+	nw = (n + 63) >> 6;
+	while ((k = atomic_fetch_add(&ctx->bitmap_row, BITMAP_CHUNK)) < n) {
+		uint32_t c = ((n - k) < BITMAP_CHUNK) ? (n - k) : BITMAP_CHUNK;
+
+		KERNEL(bitmap_rows)(k, c);
+		handoff_add(&ctx->bitmap_rows_done, c);
+	}
+	wait_for(&ctx->bitmap_rows_done, n);
+	if (sn == 0)
+		ctx->bitmap_ns = get_ns() - t1;
+
+	// The keys compatible with any seed words
+	for (uint32_t w = 0; w < nw; w++)
+		cand[w] = KERNEL(bitmap_bits)(mask, ctx->bkeys + (w << 6));
+
+	for (int i = 0, skips = 0; (i < 26) && (skips <= NUM_SKIPS); i++) {
+		struct frequency *f = frq + i;
+		uint32_t base = ctx->bbase[i], from = ctx->bbase[i + 1] >> 6;
+
+		if (mask & f->m)
+			continue;
+
+		while ((pos = atomic_fetch_add(&ctx->setpos[skips].pos, 1)) < (ctx->bbase[i + 1] - base)) {
+			k = base + pos;
+			if (!((cand[k >> 6] >> (k & 63)) & 1))
+				continue;
+
+			*sp = ctx->brefs[k];
+			uint64_t *row = ctx->bitmaps + ctx->boff[k];
+			for (uint32_t x = from; x < nw; x++)
+				next[x] = cand[x] & row[x - from];
+			KERNEL(bitmap_find)(frq, f, mask | ctx->bkeys[k], next, sp, NUM_SKIPS - skips);
+		}
+
+		if (f->m & ctx->required)
+			break;
+		skips++;
+	}
+} // bitmap_work
+
+// Counts the pairs that key k, from set i, comes first in, leaving out the
+// keys with any letters of mask.  With a tag, it also adds them to the hash
+// table, from slot on
+static KERNEL_TARGET uint32_t
+KERNEL(mitm_pairs)(uint32_t k, int i, uint32_t mask, uint32_t slot, uint32_t tag)
+{
+	uint32_t key = ctx->bkeys[k], lo = ctx->bbase[i + 1], hi = ctx->bbase[26], n = 0;
+
+	for (uint32_t w = lo >> 6; (w << 6) < hi; w++) {
+		uint64_t bits = bitmap_clip(KERNEL(bitmap_bits)(key | mask, ctx->bkeys + (w << 6)), w, lo, hi);
+
+		if (tag == 0) {
+			n += __builtin_popcountll(bits);
+			continue;
+		}
+
+		for (; bits; bits &= bits - 1, n++) {
+			uint32_t k2 = (w << 6) + __builtin_ctzll(bits);
+			struct mpair *p = ctx->mpairs + slot + n;
+			uint64_t old;
+
+			p->mask = key | ctx->bkeys[k2];
+			p->refs[0] = ctx->brefs[k];
+			p->refs[1] = ctx->brefs[k2];
+			old = __atomic_exchange_n(ctx->mheads + mitm_hash(p->mask),
+						  ((uint64_t)tag << 32) | (slot + n), __ATOMIC_RELAXED);
+			p->next = ((old >> 32) == tag) ? (uint32_t)old : MITM_NONE;
+		}
+	}
+	return n;
+} // mitm_pairs
+
+// Finds the prefix words after the one from set fi, with left more to go.
+// A word from the partition's last set or later leaves it no pairs to join
+static KERNEL_TARGET void
+KERNEL(mitm_find)(struct frequency *frq, int fi, uint32_t mask, uint32_t *sp,
+		  uint32_t skips, uint32_t left, struct mpass *mp)
+{
+	if (left == 0)
+		return mitm_join(frq, fi, mask, sp, mp);
+
+	for (int i = fi; ; skips--) {
+		while ((++i < mp->last) && (mask & frq[i].m));
+		if (i >= mp->last)
+			return;
+
+		uint32_t lo = ctx->bbase[i], hi = ctx->bbase[i + 1];
+
+		for (uint32_t w = lo >> 6; (w << 6) < hi; w++) {
+			uint64_t bits = bitmap_clip(KERNEL(bitmap_bits)(mask, ctx->bkeys + (w << 6)), w, lo, hi);
+
+			for (; bits; bits &= bits - 1) {
+				uint32_t k = (w << 6) + __builtin_ctzll(bits);
+
+				sp[1] = ctx->brefs[k];
+				KERNEL(mitm_find)(frq, i, mask | ctx->bkeys[k], sp + 1, skips, left - 1, mp);
+			}
+		}
+
+		if (!skips || (frq[i].m & ctx->required))
+			return;
+	}
+} // mitm_find
+
+// The meet in the middle engine's part of solve_work().  Each step is a
+// range of work items that the solvers share, and they all wait for one to
+// be done before starting on the next
+static KERNEL_TARGET void
+KERNEL(mitm_work)(struct frequency *frq, uint32_t *solution, uint32_t mask)
+{
+	uint32_t *sp = solution + ctx->nseeds, left = NUM_WORDS - 2 - ctx->nseeds;
+	uint32_t end = 1, start, first, n, nk, lo, hi;
+	struct mpass mp[1] = { { 0 } };
+	int i0, ir, iu, skips;
+
+	// The first words come from the first set that's left, or from those
+	// after it that can be skipped to.  The last prefix word can't be from
+	// a set before iu, so no pair's first key can be from it or before it
+	for (i0 = 0; mask & frq[i0].m; i0++);
+	for (ir = i0, skips = 0; (skips < NUM_SKIPS) && (ir < 25) && !(frq[ir].m & ctx->required); skips++)
+		while ((++ir < 25) && (mask & frq[ir].m));
+	for (iu = i0, n = 1; (n < left) && (iu < 25); n++)
+		while ((++iu < 25) && (mask & frq[iu].m));
+
+	// One solver lays the keys out
+	if (mitm_claim(end, 1, &first)) {
+		bitmap_layout();
+		for (int i = 0; i < 26; i++)
+			ctx->mbelow[i] = (i ? ctx->mbelow[i - 1] : 0) | ctx->frq[i].m;
+		handoff_add(&ctx->mitm_done, 1);
+	}
+	wait_for(&ctx->mitm_done, end);
+
+	nk = ctx->bbase[26];
+	lo = ctx->bbase[i0];
+	hi = ctx->bbase[ir + 1];
+
+	// Count the pairs that each key comes first in
+	start = end;
+	end += nk;
+	while ((n = mitm_claim(end, MITM_CHUNK, &first))) {
+		for (uint32_t k = first - start; k < (first - start + n); k++) {
+			int i = bitmap_set(k);
+
+			if ((i > iu) && !(ctx->bkeys[k] & mask))
+				ctx->mcount[k] = KERNEL(mitm_pairs)(k, i, mask, 0, 0);
+		}
+		handoff_add(&ctx->mitm_done, n);
+	}
+	wait_for(&ctx->mitm_done, end);
+
+	// One solver works out where each key's pairs go, and how many
+	// partitions they take
+	end++;
+	if (mitm_claim(end, 1, &first)) {
+		ctx->moff[0] = 0;
+		for (uint32_t k = 0; k < nk; k++)
+			ctx->moff[k + 1] = ctx->moff[k] + ctx->mcount[k];
+		for (uint32_t ka = 0; ka < nk; ka = mitm_partition(ka, nk))
+			ctx->mitm_passes++;
+		handoff_add(&ctx->mitm_done, 1);
+	}
+	wait_for(&ctx->mitm_done, end);
+
+	for (uint32_t ka = 0, kb; ka < nk; ka = kb) {
+		kb = mitm_partition(ka, nk);
+
+		int first_set = bitmap_set(ka);
+
+		mp->tag++;
+		mp->before = first_set ? ctx->mbelow[first_set - 1] : 0;
+		mp->last = bitmap_set(kb - 1);
+		mp->upto = ctx->mbelow[mp->last];
+
+		// Build the partition
+		start = end;
+		end += kb - ka;
+		while ((n = mitm_claim(end, MITM_CHUNK, &first))) {
+			for (uint32_t k = ka + first - start; k < (ka + first - start + n); k++)
+				if (ctx->mcount[k])
+					KERNEL(mitm_pairs)(k, bitmap_set(k), mask, ctx->moff[k] - ctx->moff[ka], mp->tag);
+			handoff_add(&ctx->mitm_done, n);
+		}
+		wait_for(&ctx->mitm_done, end);
+
+		// Join it with the prefixes that could use it
+		start = end;
+		end += hi - lo;
+		while ((n = mitm_claim(end, 1, &first))) {
+			uint32_t k = lo + first - start;
+			int i = bitmap_set(k);
+
+			if (!(ctx->bkeys[k] & mask) && (i < mp->last)) {
+				for (int j = skips = 0; j < i; j++)
+					skips += (j >= i0) && !(mask & frq[j].m);
+				*sp = ctx->brefs[k];
+				KERNEL(mitm_find)(frq, i, mask | ctx->bkeys[k], sp, NUM_SKIPS - skips, left - 1, mp);
+			}
+			handoff_add(&ctx->mitm_done, n);
+		}
+		wait_for(&ctx->mitm_done, end);
+	}
+} // mitm_work
+
+// Runs a task, which is up to STEAL_CHUNK depth 2 subtrees that each start
+// with one of its keys
+static KERNEL_TARGET void
+KERNEL(run_task)(struct task *tk)
+{
+	if (ctx->solver_engine == ENGINE_BFS)
+		return KERNEL(bfs_task)(tk);
+
+	uint32_t solution[NUM_WORDS + 1] __attribute__((aligned(64)));
+	uint32_t *sp = solution + tk->depth;
+
+	memcpy(solution, tk->prefix, sizeof(*solution) * tk->depth);
+
+	for (uint32_t i = 0; i < tk->n; i++) {
+		*sp = tk->refs[i];
+		KERNEL(finders)[tk->skips](tk->f, tk->mask | tk->keys[i], sp);
+	}
+} // run_task
+
+// Splits the search below a top level key into tasks on the solver's own
+// deque.  This walks the letters one level down just as a finder would,
+// after each skip too, but hands the keys it finds out in tasks instead of
+// recursing.  A task that doesn't fit on the deque is run straight away
+static KERNEL_TARGET void
+KERNEL(split)(struct deque *dq, struct frequency *f, uint32_t mask,
+	      uint32_t *solution, uint32_t depth, uint32_t skips)
+{
+	struct task tk[1];
+	uint32_t *set, *end;
+
+	// A key that completes a solution has no search below it
+	if (__builtin_popcount(mask) == COVER_LETTERS)
+		return KERNEL(finders)[skips](f, mask, solution + depth - 1);
+
+	memcpy(tk->prefix, solution, sizeof(*solution) * depth);
+	tk->mask = mask;
+	tk->depth = depth;
+
+	for (;; skips--) {
+		while (mask & (++f)->m);
+
+		CALCULATE_SET_AND_END;
+
+		tk->f = f;
+		tk->skips = skips;
+		tk->n = 0;
+		SEARCH_STAT(uint32_t len = end - set, n = 0;)
+		for (; set < end; set++) {
+			if (*set & mask)
+				continue;
+			SEARCH_STAT(n++;)
+			tk->keys[tk->n] = *set;
+			tk->refs[tk->n] = key_ref(f, set);
+			if (++tk->n < STEAL_CHUNK)
+				continue;
+			if (!deque_push(dq, tk))
+				KERNEL(run_task)(tk);
+			tk->n = 0;
+		}
+		if (tk->n && !deque_push(dq, tk))
+			KERNEL(run_task)(tk);
+		SEARCH_STAT(stats_scan(f, mask, len, n);)
+
+		if (skips == 0)
+			break;
+	}
+} // split
+
+// Thread driver.  Any seed words are already at the start of the solution
+// and their letters in the starting mask.  The top level keys are those of
+// each letter left in frequency order, after skipping the letters before
+// it, and are shared between all of the solvers via setpos[skips].  A
+// required letter may not be skipped.  Each solver splits the search below
+// its top level keys onto its own deque and works through that, and once
+// they run out it steals tasks from the solvers still busy with theirs
+static KERNEL_TARGET void
+KERNEL(solve_work)()
+{
+	uint32_t solution[NUM_WORDS + 1] __attribute__((aligned(64)));
+	uint32_t mask = ctx->seed_mask, *sp = solution + ctx->nseeds;
+	int sn = atomic_fetch_add(&ctx->solvers_started, 1);
+	struct deque *dq = ctx->deques + sn;
+	struct task *tk, stolen[1];
+	int32_t pos;
+
+	atomic_fetch_add(&ctx->solvers_busy, 1);
+	dq->start_ns = get_ns();
+	dq->steals = 0;
+	SEARCH_STAT(stats = &dq->stats;)
+	SEARCH_STAT(memset(stats, 0, sizeof(*stats));)
+
+	struct frequency *frq = get_replica(solver_node(sn));
+
+	memcpy(solution, ctx->seeds, sizeof(ctx->seeds));
+
+	if (ctx->unsolvable)
+		goto solve_work_stealing;
+
+	// With all of the words given, there's just the one solution to add
+	if (ctx->nseeds == NUM_WORDS) {
+		if (atomic_fetch_add(&ctx->setpos[0].pos, 1) == 0)
+			add_solution(frq, mask, solution);
+		goto solve_work_stealing;
+	}
+
+	if (ctx->solver_engine == ENGINE_BITMAP) {
+		KERNEL(bitmap_work)(frq, sn, solution, mask);
+		goto solve_work_stealing;
+	}
+
+	// With all but two words given, it's just the one join, which the
+	// depth first finders do as well
+	if ((ctx->solver_engine == ENGINE_MITM) && ((ctx->nseeds + 2) < NUM_WORDS)) {
+		KERNEL(mitm_work)(frq, solution, mask);
+		goto solve_work_stealing;
+	}
+
+	for (int i = 0, skips = 0; (i < 26) && (skips <= NUM_SKIPS); i++) {
+		struct frequency *f = frq + i;
+		struct tier *t = f->sets;
+
+		if (mask & f->m)
+			continue;
+
+		while ((pos = atomic_fetch_add(&ctx->setpos[skips].pos, 1)) < t->l) {
+			if (t->s[pos] & mask)
+				continue;
+			*sp = key_ref(f, t->s + pos);
+			KERNEL(split)(dq, f, mask | t->s[pos], solution, ctx->nseeds + 1, NUM_SKIPS - skips);
+
+			while ((tk = deque_pop(dq)))
+				KERNEL(run_task)(tk);
+		}
+
+		if (f->m & ctx->required)
+			break;
+		skips++;
+	}
+
+solve_work_stealing:
+	atomic_fetch_sub(&ctx->solvers_busy, 1);
+	dq->busy_ns = get_ns() - dq->start_ns;
+
+	// Tasks that are stolen never add more tasks, so once no solver
+	// is busy with its own deque, there's nothing left to steal
+	while (ctx->solvers_busy) {
+		int found = 0;
+
+		for (int v = 1; v < ctx->nthreads; v++) {
+			if (!deque_steal(ctx->deques + ((sn + v) % ctx->nthreads), stolen))
+				continue;
+
+			// Run it from this solver's own replica
+			int vn = stolen->f->node;
+			stolen->f = frq + (stolen->f - (vn ? ctx->replicas[vn - 1].frq : ctx->frq));
+
+			uint64_t t1 = get_ns();
+			KERNEL(run_task)(stolen);
+			dq->busy_ns += get_ns() - t1;
+			dq->steals++;
+			found = 1;
+		}
+
+		// Don't take the CPU from a busy solver that shares it
+		if (!found)
+			sched_yield();
+	}
+
+	dq->end_ns = get_ns();
+
+	// The last solver to finish gathers up the solutions
+	if (atomic_fetch_add(&ctx->solvers_finished, 1) == (ctx->nthreads - 1))
+		gather_solutions();
+	handoff_add(&ctx->solvers_done, 1);
+} // solve_work
@@ -0,0 +1,382 @@
+// Library build of the Parker 5x5 Unique Word Problem solver
+//
+// Author: Stew Forster (stew675@gmail.com)	Date: Aug 2022
+//
+// lib25 carries the same run-time dispatched kernels as d25, but keeps all
+// of its state in a solver_ctx per caller instead of in the process, so
+// that it can be embedded and run many solves at once.  See lib25.h
+//
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <immintrin.h>
+
+// NUM_POISON must be defined before include utilities.h
+// The AVX kernels need 16, which the scalar kernel doesn't mind
+#define	NUM_POISON	16
+#define RUNTIME_DISPATCH
+#define SOLVER_LIBRARY
+#define DONT_INCLUDE_MAIN
+
+#include "utilities.h"
+
+#define KERNEL_ISA	KERNEL_SCALAR
+#include "kernels.h"
+#undef KERNEL_ISA
+
+#define KERNEL_ISA	KERNEL_AVX2
+#include "kernels.h"
+#undef KERNEL_ISA
+
+#define KERNEL_ISA	KERNEL_AVX512
+#include "kernels.h"
+#undef KERNEL_ISA
+
+#include "lib25.h"
+
+// Only the lib25.h calls are exported from the shared library
+#define API	__attribute__ ((visibility("default")))
+
+// The context is mapped, rather than allocated, so that solver_load() can
+// hand its pages back to the kernel to get them zeroed again.  The worker
+// pool lives in the page after it, so that it survives that
+#define CTX_SIZE	((sizeof(struct solver_ctx) + 4095) & ~4095UL)
+#define POOL_SIZE	((sizeof(struct pool) + 4095) & ~4095UL)
+
+// Each context keeps a hot pool of nthreads - 1 workers, parked between
+// calls, so that a load or a solve only has to wake them up.  The calling
+// thread is always worker 0
+struct pool {
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	struct pool	*shared;	// The pool used instead.  See solver_share()
+	struct solver_ctx *sc;		// The context of the current job
+	void		(*job)(struct worker *work);	// NULL to exit
+	int		gen;		// Bumped for every new job
+	int		nworkers;	// Not counting the caller
+	atomic_int	busy	__attribute__ ((aligned(64)));
+	struct pool_arg {
+		struct pool	*pl;
+		int		n;
+	} args[MAX_THREADS];
+	pthread_t	tids[MAX_THREADS];
+};
+
+// A context made by solver_share() leaves its own pool unused
+static inline struct pool *
+ctx_pool(struct solver_ctx *sc)
+{
+	struct pool *pl = (struct pool *)((char *)sc + CTX_SIZE);
+
+	return pl->shared ? pl->shared : pl;
+} // ctx_pool
+
+static void (*solve_work_isa)() = solve_work_scalar;
+
+static void
+bind_kernels(int isa)
+{
+	if (isa == KERNEL_AVX512)
+		solve_work_isa = solve_work_avx512;
+	else if (isa == KERNEL_AVX2)
+		solve_work_isa = solve_work_avx2;
+	else
+		solve_work_isa = solve_work_scalar;
+} // bind_kernels
+
+static void
+solve_work()
+{
+	solve_work_isa();
+} // solve_work
+
+static void
+load_job(struct worker *work)
+{
+	load_work(work);
+} // load_job
+
+static void
+setup_job(struct worker *work)
+{
+	setup_work();
+} // setup_job
+
+static void
+solve_job(struct worker *work)
+{
+	solve_work();
+} // solve_job
+
+static void *
+pool_worker(void *arg)
+{
+	struct pool_arg *pa = (struct pool_arg *)arg;
+	struct pool *pl = pa->pl;
+
+	for (int gen = 0; ; ) {
+		pthread_mutex_lock(&pl->lock);
+		while (pl->gen == gen)
+			pthread_cond_wait(&pl->wake, &pl->lock);
+		gen = pl->gen;
+		void (*job)(struct worker *) = pl->job;
+		ctx = pl->sc;
+		pthread_mutex_unlock(&pl->lock);
+
+		if (job == NULL)
+			return NULL;
+
+		job(ctx->workers + pa->n);
+		handoff_add(&pl->busy, -1);
+	}
+} // pool_worker
+
+// Hands job on the current context to all of the pool's workers
+static void
+pool_start(struct pool *pl, void (*job)(struct worker *))
+{
+	pthread_mutex_lock(&pl->lock);
+	pl->sc = ctx;
+	pl->job = job;
+	pl->busy = pl->nworkers;
+	pl->gen++;
+	pthread_cond_broadcast(&pl->wake);
+	pthread_mutex_unlock(&pl->lock);
+} // pool_start
+
+// The workers are only busy for as long as the caller is, so they're
+// mostly done by the time that we get here
+static void
+pool_wait(struct pool *pl)
+{
+	for (int busy; (busy = pl->busy); )
+		wait_change(&pl->busy, busy);
+} // pool_wait
+
+void
+solve()
+{
+	struct pool *pl = ctx_pool(ctx);
+
+	pool_start(pl, solve_job);
+
+	// The calling thread also participates in finding solutions
+	solve_work();
+
+	pool_wait(pl);
+} // solve
+
+static void
+lib_init()
+{
+	select_kernels();
+} // lib_init
+
+// Each context has the default settings, as there's no call to change
+// them, and counts the nodes for itself
+static void
+ctx_init(struct solver_ctx *sc)
+{
+	ctx = sc;
+	settings_init();
+	numa_init();
+} // ctx_init
+
+static struct solver_ctx *
+ctx_map()
+{
+	static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+
+	pthread_once(&init_once, lib_init);
+
+	struct solver_ctx *sc = mmap(NULL, CTX_SIZE + POOL_SIZE, PROT_READ | PROT_WRITE,
+				     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (sc == MAP_FAILED) ? NULL : sc;
+} // ctx_map
+
+API struct solver_ctx *
+solver_create(int nthreads)
+{
+	struct solver_ctx *sc = ctx_map();
+
+	if (sc == NULL)
+		return NULL;
+
+	if (nthreads <= 0)
+		nthreads = get_nthreads();
+	if (nthreads > MAX_THREADS)
+		nthreads = MAX_THREADS;
+
+	struct pool *pl = ctx_pool(sc);
+	pthread_mutex_init(&pl->lock, NULL);
+	pthread_cond_init(&pl->wake, NULL);
+	ctx_init(sc);
+
+	// If a thread can't be created, we carry on with those that were
+	for (pl->nworkers = 0; pl->nworkers < (nthreads - 1); pl->nworkers++) {
+		struct pool_arg *pa = pl->args + pl->nworkers;
+
+		pa->pl = pl;
+		pa->n = pl->nworkers + 1;
+		if (pthread_create(pl->tids + pl->nworkers, NULL, pool_worker, pa))
+			break;
+	}
+	sc->nthreads = pl->nworkers + 1;
+
+	return sc;
+} // solver_create
+
+API struct solver_ctx *
+solver_share(struct solver_ctx *sc)
+{
+	struct solver_ctx *nsc = ctx_map();
+
+	if (nsc == NULL)
+		return NULL;
+
+	((struct pool *)((char *)nsc + CTX_SIZE))->shared = ctx_pool(sc);
+	ctx_init(nsc);
+	nsc->nthreads = sc->nthreads;
+
+	return nsc;
+} // solver_share
+
+API int
+solver_load(struct solver_ctx *sc, const char *path)
+{
+	int nthreads = sc->nthreads, ret;
+
+	// Start again from a clean context.  The kernel hands back zeroed
+	// pages as they're next touched, just as for a freshly started process
+	madvise(sc, CTX_SIZE, MADV_DONTNEED);
+	ctx_init(sc);
+	sc->nthreads = nthreads;
+
+	pool_start(ctx_pool(sc), load_job);
+
+	if ((ret = read_words((char *)path)) == 0)
+		setup_frequency_sets();
+
+	pool_wait(ctx_pool(sc));
+
+	return ret;
+} // solver_load
+
+// Builds the frequency sets over again, when the letters that are excluded
+// have changed since they were last built
+static void
+rebuild_sets()
+{
+	frq_init();
+	collate_frequencies();
+	ctx->setup_set = 0;
+	ctx->setups_done = 0;
+
+	pool_start(ctx_pool(ctx), setup_job);
+	setup_frequency_sets();
+	pool_wait(ctx_pool(ctx));
+} // rebuild_sets
+
+API int
+solver_constrain(struct solver_ctx *sc, const char *words, const char *required,
+		 const char *excluded)
+{
+	char buf[256], *w, *save;
+	uint32_t req = 0, exc = 0;
+
+	ctx = sc;
+	ctx->nseeds = 0;
+	ctx->required = ctx->excluded = 0;
+
+	if ((required && add_letters(&req, required)) || (excluded && add_letters(&exc, excluded)))
+		return -1;
+
+	if (words) {
+		strncpy(buf, words, sizeof(buf) - 1);
+		buf[sizeof(buf) - 1] = '\0';
+		for (w = strtok_r(buf, " ,", &save); w; w = strtok_r(NULL, " ,", &save))
+			if (add_seed_word(w)) {
+				ctx->nseeds = 0;
+				return -1;
+			}
+	}
+
+	ctx->required = req;
+	ctx->excluded = exc;
+	return 0;
+} // solver_constrain
+
+API int
+solver_solve(struct solver_ctx *sc)
+{
+	// Nothing has been loaded yet
+	if (sc->frq[0].sets == NULL)
+		return -1;
+
+	ctx = sc;
+	if (ctx->excluded != ctx->sets_excluded)
+		rebuild_sets();
+	if (setup_constraints() < 0)
+		return -1;
+
+	for (int s = 0; s <= NUM_SKIPS; s++)
+		ctx->setpos[s].pos = 0;
+	ctx->num_sol = 0;
+	for (int n = 0; n < MAX_NODES; n++) {
+		ctx->node_sol[n].n = 0;
+		memset(ctx->node_sol[n].chunk, 0, sizeof(ctx->node_sol[n].chunk));
+	}
+	ctx->sol_next = 0;
+	ctx->solvers_done = 0;
+	ctx->solvers_started = 0;
+	ctx->solvers_finished = 0;
+	for (int i = 0; i < ctx->nthreads; i++)
+		ctx->deques[i].top = ctx->deques[i].bottom = 0;
+
+	solve();
+
+	return ctx->num_sol;
+} // solver_solve
+
+API const char *
+solver_results(struct solver_ctx *sc, int *num, int *line_len)
+{
+	ctx = sc;
+	*num = format_solutions();
+	*line_len = SOLUTION_LEN;
+
+	return ctx->solutions;
+} // solver_results
+
+API void
+solver_destroy(struct solver_ctx *sc)
+{
+	if (sc == NULL)
+		return;
+
+	struct pool *pl = (struct pool *)((char *)sc + CTX_SIZE);
+
+	// The workers of a shared pool belong to the context that made them
+	if (pl->shared == NULL) {
+		ctx = sc;
+		pool_start(pl, NULL);
+		for (int i = 0; i < pl->nworkers; i++)
+			pthread_join(pl->tids[i], NULL);
+
+		pthread_cond_destroy(&pl->wake);
+		pthread_mutex_destroy(&pl->lock);
+	}
+	munmap(sc, CTX_SIZE + POOL_SIZE);
+} // solver_destroy
@@ -0,0 +1,73 @@
+// Library interface to the Parker 5x5 Unique Word Problem solver
+//
+// A solver_ctx holds a word list, the frequency sets built from it, and the
+// solutions last found with it.  Any number of contexts may be loaded and
+// solved at the same time, from any threads, but each context must only be
+// used by one thread at a time.  Build with make lib25.a or make lib25.so
+//
+// Each context has its own settings, at the defaults that the executables
+// use without any options, and counts the NUMA nodes for itself.  Only the
+// choice of scalar, AVX2 or AVX-512 kernels is made once for the process,
+// from what the CPU supports
+//
+//	struct solver_ctx *sc = solver_create(0);
+//	int n, len;
+//
+//	if (solver_load(sc, "words_alpha.txt") == 0) {
+//		solver_solve(sc);
+//		const char *so = solver_results(sc, &n, &len);
+//		...  n lines of len bytes each, ending in a newline
+//	}
+//	solver_destroy(sc);
+
+#ifndef LIB25_H
+#define LIB25_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct solver_ctx;
+
+// Returns a new context that uses nthreads threads to load and solve, or
+// NULL if out of memory.  0 threads picks the same default as the solvers
+struct solver_ctx *solver_create(int nthreads);
+
+// Returns a new context that uses the threads of sc, rather than starting
+// its own, or NULL if out of memory.  The two must then never be used at
+// the same time, and it must be destroyed before sc is
+struct solver_ctx *solver_share(struct solver_ctx *sc);
+
+// Reads the words from path, or stdin if it is "-", and builds the
+// frequency sets for them, replacing any words loaded before.  Returns 0
+// on success, or -1 if the file can't be read
+int solver_load(struct solver_ctx *sc, const char *path);
+
+// Limits the solutions that solver_solve() finds to those that have all of
+// words, which are separated by spaces or commas, that use all of the
+// required letters, and that use none of the excluded letters.  So for the
+// solutions that skip the letter e, exclude "e".  Any may be NULL, and all
+// NULL lifts the limits.  Returns 0, or -1 if a word is the wrong length or
+// repeats a letter, or a letter isn't a to z, which also lifts the limits.
+// They stay in place until the next solver_constrain() or solver_load()
+int solver_constrain(struct solver_ctx *sc, const char *words, const char *required,
+		     const char *excluded);
+
+// Finds all the solutions for the words loaded, and returns how many
+// there are.  May be called any number of times after a solver_load().
+// Returns -1 if nothing is loaded, or if a constraint word isn't in the
+// words loaded
+int solver_solve(struct solver_ctx *sc);
+
+// Returns the solutions found by the last solver_solve() as *num lines of
+// *line_len bytes each.  The lines are words separated by tabs, padded with
+// spaces to end in a newline.  Stays valid until the next solve or load
+const char *solver_results(struct solver_ctx *sc, int *num, int *line_len);
+
+void solver_destroy(struct solver_ctx *sc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
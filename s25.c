@@ -22,93 +22,8 @@
 
 #include "utilities.h"
 
-// ********************* SOLUTION FUNCTIONS ********************
-
-static void
-add_solution(uint32_t *sp)
-{
-	char *so = solutions + (atomic_fetch_add(&num_sol, 1) << 5);
-
-	*(uint64_t *)so = *(uint64_t *)hash_lookup(*sp++);
-	so[5] = '\t'; so += 6;
-
-	*(uint64_t *)so = *(uint64_t *)hash_lookup(*sp++);
-	so[5] = '\t'; so += 6;
-
-	*(uint64_t *)so = *(uint64_t *)hash_lookup(*sp++);
-	so[5] = '\t'; so += 6;
-
-	*(uint64_t *)so = *(uint64_t *)hash_lookup(*sp++);
-	so[5] = '\t'; so += 6;
-
-	*(uint64_t *)so = *(uint64_t *)hash_lookup(*sp);
-	so[5] = ' '; so[6] = ' '; so[7] = '\n';
-} // add_solution
-
-void
-find_skipped(struct frequency *f, uint32_t mask, uint32_t *sp)
-{
-	if (__builtin_popcount(mask) == 25)
-		return add_solution(sp - 4);
-
-	uint32_t ks[1024] __attribute__((aligned(64)));
-	uint32_t key, *set, *end, *kp = ks;
-
-	while (mask & (++f)->m);
-
-	CALCULATE_SET_AND_END;
-
-	while (set < end)
-		kp += !((*kp = *set++) & mask);
-
-	for (sp++, *kp = 0, kp = ks; (*sp = key = *kp++); )
-		find_skipped(f,  mask | key, sp);
-} // find_solutions
-
-// Since find_solutions() is the busiest function we keep the loops
-// within it as small and tight as possible for the most speed
-void
-find_solutions(struct frequency *f, uint32_t mask, uint32_t *sp)
-{
-	if (__builtin_popcount(mask) == 25)
-		return add_solution(sp - 4);
-
-	uint32_t ks[1024] __attribute__((aligned(64)));
-	uint32_t key, *set, *end, *kp = ks;
-
-	while (mask & (++f)->m);
-
-	CALCULATE_SET_AND_END;
-
-	while (set < end)
-		kp += !((*kp = *set++) & mask);
-
-	for (sp++, *kp = 0, kp = ks; (*sp = key = *kp++); )
-		find_solutions(f, mask | key, sp);
-
-	find_skipped(f, mask, sp - 1);
-} // find_solutions
-
-// Thread driver
-void
-solve_work()
-{
-	uint32_t solution[6] __attribute__((aligned(64)));
-	struct tier *t;
-	int32_t pos;
-
-	// Solve starting with least frequent set
-	t = frq[0].sets;
-	while ((pos = atomic_fetch_add(&set0pos, 1)) < t->l)
-		find_solutions(frq, (*solution = t->s[pos]), solution);
-
-	// Solve after skipping least frequent set
-	t = frq[1].sets;
-	while ((pos = atomic_fetch_add(&set1pos, 1)) < t->l)
-		find_skipped(frq + 1, (*solution = t->s[pos]), solution);
-
-	atomic_fetch_add(&solvers_done, 1);
-} // solve_work
+#define KERNEL_ISA	KERNEL_SCALAR
+#include "kernels.h"
 
 void
 solve()
@@ -120,6 +35,5 @@ solve()
 	solve_work();
 
 	// Wait for any other threads to finish up
-	while(solvers_done < nthreads)
-		usleep(1);
+	wait_for(&ctx->solvers_done, ctx->nthreads);
 } // solve
@@ -0,0 +1,424 @@
+// A daemon for the Parker 5x5 Unique Word Problem
+//
+// Author: Stew Forster (stew675@gmail.com)	Date: Aug 2022
+//
+// srv25 loads the word file once, and then keeps the worker pool and the
+// frequency sets resident while it answers requests over a Unix domain
+// socket.  Each request then only costs the solve, without the process
+// start-up, thread creation and file load that the executables pay for.
+//
+// Requests and replies are single lines of text, and a connection may make
+// any number of requests.  Many connections may be open at once, and each
+// request is served as soon as its line has arrived, taking turns with the
+// requests of the other connections.  A connection that sends nothing for
+// IDLE_SECS, or that doesn't take all of a reply within SEND_SECS, gets
+// closed, so that no client can keep the others waiting for longer than that
+//
+//	solve		ok <num>, followed by the num solution lines
+//	load <file>	ok <file>, having swapped in the words from file, which
+//			must be a regular file
+//	quit		Closes the connection
+//
+// A solve may be limited with the same options as the solvers take.  Each
+// -w names a word that every solution must have, -i letters that every
+// solution must use, and -x letters that none may, such as the letter that
+// must be skipped.  For example: solve -w fjord -x q
+//
+// Anything that fails gets a reply of "error <reason>" instead
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include "lib25.h"
+
+#define MAX_REQUEST	512
+#define MAX_CLIENTS	64
+#define IDLE_SECS	60
+#define SEND_SECS	10
+
+// Each connection keeps whatever it has sent of its requests until it's
+// served them.  A free slot has an fd of -1
+struct client {
+	int		fd;
+	int		eof;		// It's sent all it's going to
+	uint64_t	last;		// When it last sent anything
+	size_t		have;
+	char		buf[MAX_REQUEST * 2];
+};
+
+static const char	*socket_path = "/tmp/srv25.sock";
+static struct client	clients[MAX_CLIENTS];
+static struct solver_ctx *sc = NULL;	// Has the words in use
+static struct solver_ctx *spare = NULL;	// Shares the pool of sc.  See do_load()
+static int	nthreads = 0;
+static int	write_metrics = 0;
+
+static inline uint64_t
+get_ns()
+{
+	struct timespec ts[1];
+
+	clock_gettime(CLOCK_MONOTONIC, ts);
+	return (ts->tv_sec * 1000000000ULL) + ts->tv_nsec;
+} // get_ns
+
+static void
+stop(int sig)
+{
+	unlink(socket_path);
+	_exit(0);
+} // stop
+
+// Writes out all of the iovecs, no matter how many short writes it takes,
+// so long as they take no longer than SEND_SECS all up.  Each write that the
+// client doesn't make room for gives up after SEND_SECS too.  See add_client()
+static int
+write_all(int fd, struct iovec *iov, int n)
+{
+	uint64_t start = get_ns();
+
+	while (n > 0) {
+		ssize_t ret = writev(fd, iov, n);
+
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+
+		for (; (n > 0) && (ret >= iov->iov_len); n--)
+			ret -= (iov++)->iov_len;
+		if (n > 0) {
+			if ((get_ns() - start) > (SEND_SECS * 1000000000ULL))
+				return -1;
+			iov->iov_base = (char *)iov->iov_base + ret;
+			iov->iov_len -= ret;
+		}
+	}
+	return 0;
+} // write_all
+
+static int
+reply(int fd, const char *msg)
+{
+	struct iovec iov[1] = { { (void *)msg, strlen(msg) } };
+
+	return write_all(fd, iov, 1);
+} // reply
+
+// Applies the constraints given in args to the solve.  Returns -1 if they
+// don't parse
+static int
+constrain(char *args)
+{
+	char words[MAX_REQUEST * 2] = "", *required = NULL, *excluded = NULL;
+	char *opt, *arg, *save;
+
+	for (opt = strtok_r(args, " ", &save); opt; opt = strtok_r(NULL, " ", &save)) {
+		if ((arg = strtok_r(NULL, " ", &save)) == NULL)
+			return -1;
+
+		if (!strcmp(opt, "-w")) {
+			strcat(words, " ");
+			strcat(words, arg);
+		} else if (!strcmp(opt, "-i"))
+			required = arg;
+		else if (!strcmp(opt, "-x"))
+			excluded = arg;
+		else
+			return -1;
+	}
+
+	return solver_constrain(sc, words, required, excluded);
+} // constrain
+
+static int
+do_solve(int fd, char *args)
+{
+	char hdr[64];
+	int num, len;
+	uint64_t t = get_ns();
+
+	if (constrain(args) < 0)
+		return reply(fd, "error bad constraint\n");
+
+	if (solver_solve(sc) < 0)
+		return reply(fd, "error word not in word list\n");
+
+	const char *so = solver_results(sc, &num, &len);
+
+	if (write_metrics)
+		printf("solve: %d solutions in %.6fs\n", num, (get_ns() - t) / 1e9);
+
+	snprintf(hdr, sizeof(hdr), "ok %d\n", num);
+	struct iovec iov[2] = {
+		{ hdr, strlen(hdr) },
+		{ (void *)so, (size_t)num * len },
+	};
+	return write_all(fd, iov, 2);
+} // do_solve
+
+// The new words are loaded into the spare context, which shares its threads
+// with the one in use, and the two only swap once the load has worked, so
+// that the old words are kept should it fail.  Only regular files are
+// loaded, as solver_load() would read "-" from our own stdin, and a pipe or
+// a device could keep us from serving anyone else for as long as it liked
+static int
+do_load(int fd, char *file)
+{
+	char msg[MAX_REQUEST + 16];
+	struct solver_ctx *t;
+	struct stat st[1];
+	uint64_t ns = get_ns();
+
+	if (strcmp(file, "-") && (stat(file, st) < 0)) {
+		snprintf(msg, sizeof(msg), "error unable to read %s\n", file);
+		return reply(fd, msg);
+	}
+	if (!strcmp(file, "-") || !S_ISREG(st->st_mode)) {
+		snprintf(msg, sizeof(msg), "error %s is not a regular file\n", file);
+		return reply(fd, msg);
+	}
+
+	if (solver_load(spare, file) < 0) {
+		snprintf(msg, sizeof(msg), "error unable to read %s\n", file);
+		return reply(fd, msg);
+	}
+
+	t = sc;
+	sc = spare;
+	spare = t;
+
+	if (write_metrics)
+		printf("load: %s in %.6fs\n", file, (get_ns() - ns) / 1e9);
+
+	snprintf(msg, sizeof(msg), "ok %s\n", file);
+	return reply(fd, msg);
+} // do_load
+
+static void
+drop_client(struct client *c)
+{
+	close(c->fd);
+	c->fd = -1;
+} // drop_client
+
+static void
+add_client(int fd)
+{
+	struct timeval tv[1] = { { SEND_SECS, 0 } };
+
+	for (int i = 0; i < MAX_CLIENTS; i++) {
+		struct client *c = clients + i;
+
+		if (c->fd < 0) {
+			// A reply that the client won't take fails after SEND_SECS
+			setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, tv, sizeof(tv));
+			c->fd = fd;
+			c->eof = 0;
+			c->have = 0;
+			c->last = get_ns();
+			return;
+		}
+	}
+	close(fd);
+} // add_client
+
+// Reads whatever the client has sent.  Returns -1 if it must be dropped
+static int
+read_client(struct client *c)
+{
+	ssize_t n = read(c->fd, c->buf + c->have, sizeof(c->buf) - c->have - 1);
+
+	if (n < 0)
+		return ((errno == EINTR) || (errno == EAGAIN)) ? 0 : -1;
+	if (n == 0) {
+		c->eof = 1;
+		return 0;
+	}
+
+	c->have += n;
+	c->last = get_ns();
+
+	if ((c->have >= MAX_REQUEST) && !memchr(c->buf, '\n', c->have)) {
+		reply(c->fd, "error request too long\n");
+		return -1;
+	}
+	return 0;
+} // read_client
+
+// Serves the first request that the client has sent all of, if any.
+// Returns 1 if it served one, 0 if there wasn't one, or -1 if the client
+// must be dropped
+static int
+serve(struct client *c)
+{
+	char *s = c->buf, *e = memchr(c->buf, '\n', c->have);
+	int ret;
+
+	if (e == NULL)
+		return 0;
+
+	*e = '\0';
+	if ((e > s) && (e[-1] == '\r'))
+		e[-1] = '\0';
+
+	if (!strcmp(s, "solve"))
+		ret = do_solve(c->fd, s + 5);
+	else if (!strncmp(s, "solve ", 6))
+		ret = do_solve(c->fd, s + 6);
+	else if (!strncmp(s, "load ", 5))
+		ret = do_load(c->fd, s + 5);
+	else if (!strcmp(s, "quit"))
+		ret = -1;
+	else
+		ret = reply(c->fd, "error unknown request\n");
+
+	// Keep the rest for the next turn
+	c->have -= (e + 1) - s;
+	memmove(c->buf, e + 1, c->have);
+
+	return (ret < 0) ? -1 : 1;
+} // serve
+
+int
+main(int argc, char *argv[])
+{
+	char *file = "words_alpha.txt";
+	struct sockaddr_un addr[1];
+	int sfd;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strncmp(argv[i], "-v", 2)) {
+			write_metrics = 1;
+			continue;
+		}
+
+		if (!strncmp(argv[i], "-f", 2) && ((i + 1) < argc)) {
+			file = argv[++i];
+			continue;
+		}
+
+		if (!strncmp(argv[i], "-t", 2) && ((i + 1) < argc)) {
+			nthreads = atoi(argv[++i]);
+			continue;
+		}
+
+		if (!strncmp(argv[i], "-S", 2) && ((i + 1) < argc)) {
+			socket_path = argv[++i];
+			continue;
+		}
+
+		printf("Usage: %s [-v] [-t num_threads] [-f filename] [-S socket]\n", argv[0]);
+		exit(1);
+	}
+
+	if (((sc = solver_create(nthreads)) == NULL) || ((spare = solver_share(sc)) == NULL)) {
+		fprintf(stderr, "Unable to create the solver\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (solver_load(sc, file) < 0)
+		exit(EXIT_FAILURE);
+
+	memset(addr, 0, sizeof(addr));
+	addr->sun_family = AF_UNIX;
+	if (strlen(socket_path) >= sizeof(addr->sun_path)) {
+		fprintf(stderr, "Socket path %s is too long\n", socket_path);
+		exit(EXIT_FAILURE);
+	}
+	strcpy(addr->sun_path, socket_path);
+
+	if ((sfd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+		perror("socket");
+		exit(EXIT_FAILURE);
+	}
+
+	unlink(socket_path);
+	if ((bind(sfd, (struct sockaddr *)addr, sizeof(addr)) < 0) || (listen(sfd, 16) < 0)) {
+		perror(socket_path);
+		exit(EXIT_FAILURE);
+	}
+
+	// A client that goes away mid-reply must not take us down with it
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+
+	if (write_metrics) {
+		printf("Listening on %s\n", socket_path);
+		fflush(stdout);
+	}
+
+	for (int i = 0; i < MAX_CLIENTS; i++)
+		clients[i].fd = -1;
+
+	for (;;) {
+		struct pollfd pfd[MAX_CLIENTS + 1];
+		int timeout = 1000;
+
+		// Poll for new connections, and for more from the clients that
+		// are still sending.  If any already have a request waiting, then
+		// only look for what's come in without waiting
+		pfd[MAX_CLIENTS].fd = sfd;
+		pfd[MAX_CLIENTS].events = POLLIN;
+		for (int i = 0; i < MAX_CLIENTS; i++) {
+			struct client *c = clients + i;
+
+			pfd[i].fd = ((c->fd < 0) || c->eof) ? -1 : c->fd;
+			pfd[i].events = POLLIN;
+			if ((c->fd >= 0) && memchr(c->buf, '\n', c->have))
+				timeout = 0;
+		}
+
+		if (poll(pfd, MAX_CLIENTS + 1, timeout) < 0) {
+			if (errno != EINTR)
+				perror("poll");
+			continue;
+		}
+
+		if (pfd[MAX_CLIENTS].revents & POLLIN) {
+			int fd = accept(sfd, NULL, NULL);
+
+			if (fd >= 0)
+				add_client(fd);
+			else if (errno != EINTR)
+				perror("accept");
+		}
+
+		// Each client gets one request served per turn
+		for (int i = 0; i < MAX_CLIENTS; i++) {
+			struct client *c = clients + i;
+
+			if (c->fd < 0)
+				continue;
+
+			if ((pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) && (read_client(c) < 0)) {
+				drop_client(c);
+				continue;
+			}
+
+			int served = serve(c);
+
+			if ((served < 0) || ((served == 0) && c->eof))
+				drop_client(c);
+			else if ((served == 0) && ((get_ns() - c->last) > (IDLE_SECS * 1000000000ULL)))
+				drop_client(c);
+		}
+
+		if (write_metrics)
+			fflush(stdout);
+	}
+} // main
@@ -1,21 +1,103 @@
 #include <immintrin.h>
+#include <errno.h>
+#include <sched.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <limits.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define HAVE_IO_URING
+#endif
+
+// The shape of a solution.  By default that is 5 words of 5 letters, using
+// 25 of the 26 letters.  Build with eg. -DWORD_LEN=4 -DNUM_WORDS=6 for other
+// shapes.  Any letters not covered by a solution are skipped by the solver
+#ifndef WORD_LEN
+#define WORD_LEN               5
+#endif
+#ifndef NUM_WORDS
+#define NUM_WORDS              5
+#endif
+
+#define COVER_LETTERS       (WORD_LEN * NUM_WORDS)
+#define NUM_SKIPS           (26 - COVER_LETTERS)
+
+// Words are kept in 8 byte slots, and solutions in 32 byte lines, or in
+// 64 byte lines for shapes with too many words to fit in 32 bytes, such
+// as the 13 words of 2 letters that exactly cover all 26 letters
+#if (WORD_LEN < 2) || (WORD_LEN > 7)
+#error "WORD_LEN must be from 2 to 7"
+#endif
+#if (NUM_WORDS < 2) || ((NUM_WORDS * (WORD_LEN + 1)) > 64)
+#error "NUM_WORDS words of WORD_LEN letters don't fit a 64 byte solution line"
+#endif
+#if (NUM_SKIPS < 0) || (NUM_SKIPS > 6)
+#error "Solutions must cover from 20 to 26 letters"
+#endif
+
+#if (NUM_WORDS * (WORD_LEN + 1)) > 32
+#define SOLUTION_SHIFT       6
+#else
+#define SOLUTION_SHIFT       5
+#endif
+#define SOLUTION_LEN        (1 << SOLUTION_SHIFT)
 
 #define HASHBITS              15
+#ifndef MAX_SOLUTIONS
 #define MAX_SOLUTIONS       8192
+#endif
+// The NUMA nodes claim lines of the solutions array this many at a time
+#define SOL_CHUNK             64
+#define SOL_CHUNKS          ((MAX_SOLUTIONS + SOL_CHUNK - 1) / SOL_CHUNK)
+// words_alpha has ~6K unique keys for 5 letter words, but ~9K and ~10K
+// for 6 and 7 letter words
+#ifndef MAX_WORDS
+#if WORD_LEN > 5
+#define MAX_WORDS          16384
+#else
 #define MAX_WORDS           8192
-#define MAX_THREADS           16
+#endif
+#endif
+#ifndef MAX_THREADS
+#define MAX_THREADS          256
+#endif
+#define MAX_NODES              8	// NUMA nodes with their own replica
 #define MAX_READERS            8	// No more than 8 ever needed
 
+// Each frequency set is split by TIER_BITS of its tier letters into 1 <<
+// TIER_BITS subsets.  More letters pass over more keys, but take more
+// memory and setup for their copies of the keys.  -d uses fewer at run time
+#ifndef TIER_BITS
+#define TIER_BITS              4
+#endif
+#if (TIER_BITS < 2) || (TIER_BITS > 7)
+#error "TIER_BITS must be from 2 to 7"
+#endif
+#define NUM_TIERS           (1 << TIER_BITS)
+#define BITMAP_WORDS        ((MAX_WORDS + 63) / 64)	// Per key.  See kernels.h
+// All of the sets share the one tkeys array.  Each set is given room for
+// its keys and its poison in each of its tier subsets.  See
+// setup_frequency_sets()
+#define TIER_KEYS           (((MAX_WORDS + (26 * NUM_POISON)) << TIER_BITS) + (26 * 16))
+
 static const char	*solution_filename = "solutions.txt";
 
 // Worker thread state
-static struct worker {
+struct worker {
 	char     *start;
 	char     *end;
-} workers[MAX_THREADS] __attribute__ ((aligned(64)));
+	uint64_t io_ns;		// Time spent waiting on chunk reads
+	uint64_t scan_ns;	// Time spent finding words in chunks
+	uint32_t chunks;	// Number of chunks processed
+#ifdef SOLVER_LIBRARY
+	struct solver_ctx *ctx;	// The context that the worker is for
+#endif
+} __attribute__ ((aligned(64)));
 
 // Set Pointers (32 bytes in size)
-static struct tier {
+struct tier {
 	// Pointer to set
 	uint32_t	*s __attribute__ ((aligned(32)));
 	uint32_t	l;	// Length of set
@@ -23,65 +105,341 @@ static struct tier {
 	uint32_t	toff2;	// Tiered Offset 2
 	uint32_t	toff3;	// Tiered Offset 3
 	uint32_t	tlen3;	// Length of toff3
-} tiers[26][16] __attribute__ ((aligned(64)));
+};
 
 // Character frequency recording
-static struct frequency {
+struct frequency {
 	// Mask (1 << (c - 'a'))
 	uint32_t	m	__attribute__ ((aligned(64)));
 	int32_t		f;		// Frequency
-	uint32_t	tm1;		// Tiered Mask 1
-	uint32_t	tm2;		// Tiered Mask 2
-	uint32_t	tm3;		// Tiered Mask 3
-	uint32_t	tm4;		// Tiered Mask 4
-	uint32_t	tm5;		// Tiered Mask 5
-	uint32_t	tm6;		// Tiered Mask 6
-	uint32_t	tmm;		// Logical OR of tm1..tm4
-	int		ready;		// Ready to set up
+	uint32_t	tm[TIER_BITS];	// Tiered Masks that split the set
+	uint32_t	tw1;		// Tiered Window Mask 1
+	uint32_t	tw2;		// Tiered Window Mask 2
+	uint32_t	tmm;		// Logical OR of tm[]
+	atomic_int	ready;		// 1 when ready to set up, 2 once counted
 	int		b;		// char - 'a'
+	uint32_t	node;		// NUMA node whose replica this is in
 	struct tier	*sets;
-} frq[26] __attribute__ ((aligned(64)));
-
-// Keep atomic variables on their own CPU cache line
-atomic_int 	num_words	__attribute__ ((aligned(64))) = 0;
-atomic_int	file_pos	__attribute__ ((aligned(64))) = 0;
-atomic_int	num_sol		__attribute__ ((aligned(64))) = 0;
-atomic_int	setup_set	__attribute__ ((aligned(64))) = 0;
-atomic_int	setups_done	__attribute__ ((aligned(64))) = 0;
-atomic_int	readers_done	__attribute__ ((aligned(64))) = 0;
-atomic_int	solvers_done	__attribute__ ((aligned(64))) = 0;
-atomic_int	first_rdr_done	__attribute__ ((aligned(64))) = 0;
-atomic_int	set0pos		__attribute__ ((aligned(64))) = 0;
-atomic_int	set1pos		__attribute__ ((aligned(64))) = 0;
-
-// Put volatile thread sync variables on their own CPU cache line
-static volatile int	workers_start	__attribute__ ((aligned(64))) = 0;
-static volatile int	go_solve	__attribute__ ((aligned(64))) = 0;
-static volatile int	num_readers	__attribute__ ((aligned(64))) = 0;
-
-// Put all general global variables together on their own CPU cache line
-static uint32_t hash_collisions __attribute__ ((aligned(64))) = 0;
-static int	write_metrics = 0;
-static int	nthreads = 0;
-static int	nkeys = 0;
+	uint32_t	*tkeys;		// The tkeys that sets point into
+};
+
+// Work stealing solver tasks.  See WORK STEALING in kernels.h
+#define STEAL_CHUNK	8	// Depth 2 subtrees per task
+#define DEQUE_SIZE	256	// Tasks per solver deque.  Must be a power of 2
+
+struct task {
+	struct frequency *f;		// Letter that the keys were taken from
+	uint32_t	mask;		// Letters used before the keys
+	uint32_t	skips;		// Skips left after the keys
+	uint32_t	depth;		// Number of words in prefix
+	uint32_t	n;		// Number of keys
+	uint32_t	prefix[NUM_WORDS];
+	uint32_t	keys[STEAL_CHUNK];
+	uint32_t	refs[STEAL_CHUNK];	// Their key refs
+};
+
+// The disjoint pairs of keys that the meet in the middle engine joins
+// with.  See MEET IN THE MIDDLE ENGINE in kernels.h
+#define MITM_BITS	20
+#define MITM_PAIRS	(1 << MITM_BITS)	// Pairs per partition
+#define MITM_HEADS	(2 << MITM_BITS)	// Hash chains for them
+#define MITM_NONE	((uint32_t)(~0))	// End of a chain
+
+#if MAX_WORDS >= MITM_PAIRS
+#error "MAX_WORDS must be less than MITM_PAIRS"
+#endif
 
-// We build the solutions directly as a character array to write out when done
-static char     solutions[MAX_SOLUTIONS * 32] __attribute__ ((aligned(64)));
+struct mpair {
+	uint32_t	mask;		// Letters of both keys
+	uint32_t	refs[2];	// Key refs, in frequency set order
+	uint32_t	next;		// Next pair on the hash chain
+};
+
+// Building with -DSEARCH_STATS counts what the finders do, per solver, for
+// -v to report.  Without it SEARCH_STAT() compiles away to nothing.  See
+// SEARCH STATS in kernels.h
+#ifdef SEARCH_STATS
+struct search_stats {
+	uint64_t	calls[NUM_SKIPS + 1][NUM_WORDS + 1];	// By skips left and depth
+	uint64_t	scans[NUM_WORDS];	// Tier ranges scanned, by depth
+	uint64_t	scanned[NUM_WORDS];	// Keys in them
+	uint64_t	matched[NUM_WORDS];	// Keys compatible with the mask
+	uint64_t	empty[NUM_WORDS];	// Ranges with none compatible
+	uint64_t	set_scans[26][NUM_WORDS];	// Scans by letter and depth
+};
+#define SEARCH_STAT(...)	__VA_ARGS__
+#else
+#define SEARCH_STAT(...)
+#endif
 
-// Allow for up to 3x the number of unique non-anagram words
-static char     words[MAX_WORDS * 24] __attribute__ ((aligned(64)));
-static uint32_t wordkeys[MAX_WORDS * 3] __attribute__ ((aligned(64)));
+struct deque {
+	atomic_int	top	__attribute__ ((aligned(64)));	// Thieves take from here
+	atomic_int	bottom	__attribute__ ((aligned(64)));	// The owner works here
+	uint64_t	start_ns __attribute__ ((aligned(64)));
+	uint64_t	end_ns;
+	uint64_t	busy_ns;	// Time spent solving, less time spent stealing
+	uint32_t	steals;		// Tasks taken from other solvers
+#ifdef SEARCH_STATS
+	struct search_stats stats;
+#endif
+	struct task	tasks[DEQUE_SIZE];
+};
+
+// A copy of everything the solvers read, for one NUMA node.  tkeys has the
+// same layout as the original, so key refs are the same in every copy
+struct replica {
+	struct frequency	frq[26]		__attribute__ ((aligned(4096)));
+	struct tier		tiers[26][NUM_TIERS]	__attribute__ ((aligned(64)));
+	uint32_t		tkeys[TIER_KEYS] __attribute__ ((aligned(64)));
+};
+
+#define REPLICA_STALE	0
+#define REPLICA_COPYING	1
+#define REPLICA_READY	2
+
+// Hash table size.  See HASH TABLE FUNCTIONS
+#define	HASHSZ          (1 << HASHBITS)
+#define HASHMASK        (HASHSZ - 1)
 
-// We add 1024 here to MAX_WORDS to give us extra space to perform vector
-// alignments for the AVX functions.  At the very least the keys array must
-// be 32-byte aligned, but we align it to 64 bytes anyway
-static	uint32_t	keys[MAX_WORDS + 1024] __attribute__ ((aligned(64)));
-static	uint32_t	tkeys[26][MAX_WORDS * 2] __attribute__ ((aligned(64)));
-static	uint32_t	unmap[32] __attribute__((aligned(64)));
+// Perfect hash partitions.  See MINIMAL PERFECT HASH
+#define MPH_PART_BITS	6
+#define MPH_PARTS	(1 << MPH_PART_BITS)
+#define MPH_LAMBDA	2	// Average keys per bucket
+#define MPH_D1_BITS	10
+#define MPH_MAX_PART	(1 << MPH_D1_BITS)	// Most keys a partition can have
+#define MPH_MAX_D0	(1 << (16 - MPH_D1_BITS))
+
+struct mph_part {
+	uint64_t	m;	// Lemire fastmod constant for n
+	uint64_t	seed;	// Seed for the A and B hash values
+	uint32_t	off;	// First key, slot and bucket of partition
+	uint32_t	n;	// Number of keys and slots in partition
+	uint32_t	nb;	// Number of buckets in partition
+};
+
+// File reader buffers.  See FILE READER and STREAM READER
+#define READ_CHUNK        65536		// Appears to be optimum
 
-// Per-reader frequency collation stats.  We set to 32, instead of just 26, to
-// ensure readers aren't sharing CPU cache lines (which are 64 bytes wide)
-static	uint32_t	cfs[MAX_READERS][32] __attribute__((aligned(64))) = {0};
+// The chunk buffers hold READ_TAIL bytes past the chunk, so that any word
+// starting within the chunk is seen in full, plus room for a sentinel and
+// the 64-bit word copy in find_words() to over-read into
+#define READ_TAIL	64
+#define READ_LEN	(READ_CHUNK + READ_TAIL)
+#define READ_BUF_LEN	(READ_LEN + 64)
+#define URING_DEPTH	4		// Reads in flight per reader
+
+#define STREAM_BUFS	3
+#define STREAM_CARRY	64	// Longest partial line carried over
+
+struct stream_buf {
+	char		*s	__attribute__ ((aligned(64)));
+	char		*e;
+	atomic_int	freed;		// Sequence number + 1 of the last scan
+};
+
+// ********************* SOLVER STATE ********************
+
+// Everything that one solve reads, builds and finds lives in a solver_ctx.
+// The executables have just the one, at a fixed address, so that using it
+// costs no more than the plain globals it replaced.  With SOLVER_LIBRARY it
+// is allocated by solver_create() instead, and every thread working on it
+// points its own ctx at it, so that any number of solves can run at once
+struct solver_ctx {
+	// Keep atomic variables on their own CPU cache line
+	atomic_int 	num_words	__attribute__ ((aligned(64)));
+	atomic_int 	num_keys	__attribute__ ((aligned(64)));
+	atomic_int	file_pos	__attribute__ ((aligned(64)));
+	atomic_int	num_sol		__attribute__ ((aligned(64)));
+	atomic_int	setup_set	__attribute__ ((aligned(64)));
+	atomic_int	setups_done	__attribute__ ((aligned(64)));
+	atomic_int	readers_done	__attribute__ ((aligned(64)));
+	atomic_int	solvers_done	__attribute__ ((aligned(64)));
+	atomic_int	solvers_started	__attribute__ ((aligned(64)));
+	atomic_int	solvers_busy	__attribute__ ((aligned(64)));
+	atomic_int	solvers_finished __attribute__ ((aligned(64)));
+
+	// Put volatile thread sync variables on their own CPU cache line
+	atomic_int	workers_start	__attribute__ ((aligned(64)));
+	atomic_int	go_solve	__attribute__ ((aligned(64)));
+	volatile int	num_readers	__attribute__ ((aligned(64)));
+
+	// Put all general variables together on their own CPU cache line
+	atomic_uint	hash_collisions	__attribute__ ((aligned(64)));
+	int		nthreads;
+	int		nkeys;
+	int		use_mph;
+	int		reader_backend;
+	int		cache_hit;
+	int		read_fd;
+	off_t		read_len;
+
+	// Settings, which the executables take from the command line.  See
+	// settings_init()
+	int		tier_bits;	// Tier letters that split the sets.  From -d
+	int		spin_budget;	// Polls before a wait sleeps.  From -s
+	int		solver_engine;	// From -e
+	int		num_nodes;	// Nodes that the solvers are spread over
+	int		force_nodes;	// From -n.  Solvers use them round robin
+
+	// Top level solver positions.  setpos[n] is for the set that comes
+	// after skipping the n least frequent letters.  See kernels.h
+	struct {
+		atomic_int	pos	__attribute__ ((aligned(64)));
+	} setpos[NUM_SKIPS + 1];
+
+	// Constraints on the solutions.  See CONSTRAINTS
+	uint32_t	excluded;	// Letters that no solution may use
+	uint32_t	required;	// Letters that every solution must use
+	uint32_t	sets_excluded;	// Letters the frequency sets were built without
+	uint32_t	seed_mask;	// Letters of the seed words
+	int		nseeds;		// Number of seed words
+	int		unsolvable;	// The constraints contradict each other
+	uint32_t	seed_keys[NUM_WORDS];	// Words that every solution must have
+	uint32_t	seeds[NUM_WORDS];	// Their key refs, in solution order
+
+	struct worker		workers[MAX_THREADS];
+	struct deque		deques[MAX_THREADS];
+	struct tier		tiers[26][NUM_TIERS]	__attribute__ ((aligned(64)));
+	struct frequency	frq[26]		__attribute__ ((aligned(64)));
+
+	// How many keys of each frequency set have each letter, and the scan
+	// lengths expected with the tier letters.  See choose_tier_letters()
+	uint32_t	set_letters[26][32]	__attribute__ ((aligned(64)));
+	float		tier_scan[26];		// With the letters chosen
+	float		uaeios_scan[26];	// With the static "uaeios"
+
+	// We build the solutions directly as a character array to write out when
+	// done.  Each NUMA node claims SOL_CHUNK lines at a time from sol_next,
+	// and gather_solutions() then moves them together.  See NUMA
+	char		solutions[MAX_SOLUTIONS * SOLUTION_LEN] __attribute__ ((aligned(64)));
+	struct {
+		atomic_int	n	__attribute__ ((aligned(64)));
+		atomic_int	chunk[SOL_CHUNKS];	// 1 + the first line of each
+	} node_sol[MAX_NODES];
+	atomic_int	sol_next;	// The next line to hand out
+	int		num_dropped;	// Solutions found after all lines were out
+
+	// Allow for up to 3x the number of unique non-anagram words
+	char		words[MAX_WORDS * 24] __attribute__ ((aligned(64)));
+
+	// We add 1024 here to MAX_WORDS to give us extra space to perform vector
+	// alignments for the AVX functions.  At the very least the keys array must
+	// be 32-byte aligned, but we align it to 64 bytes anyway
+	uint32_t	keys[MAX_WORDS + 1024] __attribute__ ((aligned(64)));
+	uint32_t	tkeys[TIER_KEYS] __attribute__ ((aligned(64)));
+
+	// With WORD_INDEX defined, every key in tkeys has the index of its word in
+	// words[] at the same position in tidx.  The solvers then record where in
+	// tkeys each solution key was, instead of the key itself, and so never need
+	// to look a word up by its key.  The solutions are kept as word indices, and
+	// only get formatted when they're written out
+#ifdef WORD_INDEX
+	uint32_t	tidx[TIER_KEYS] __attribute__ ((aligned(64)));
+	uint32_t	solidx[MAX_SOLUTIONS][NUM_WORDS] __attribute__ ((aligned(64)));
+#endif
+	uint32_t	unmap[32] __attribute__((aligned(64)));
+
+	// The bitmap engine lays all of the keys out in frequency set order, and
+	// gives each a bitmap of the keys of the later sets that have none of its
+	// letters.  See BITMAP ENGINE in kernels.h
+	uint32_t	bkeys[MAX_WORDS + 64] __attribute__ ((aligned(64)));
+	uint32_t	brefs[MAX_WORDS];	// Their key refs
+	uint32_t	bbase[27];		// Where each set starts in bkeys
+	uint32_t	boff[MAX_WORDS];	// Where each key's bitmap starts
+	uint32_t	bwords;			// Bitmap words for all of the keys
+	uint64_t	bitmap_ns;		// Time taken to build the bitmaps
+	atomic_int	bitmap_ready	__attribute__ ((aligned(64)));
+	atomic_int	bitmap_row	__attribute__ ((aligned(64)));
+	atomic_int	bitmap_rows_done __attribute__ ((aligned(64)));
+	uint64_t	bitmaps[MAX_WORDS * BITMAP_WORDS] __attribute__ ((aligned(64)));
+
+	// The meet in the middle engine shares that key layout, and joins the
+	// prefixes of all but the last two words with a hash table of the pairs
+	// of keys, a partition of them at a time
+	uint32_t	mcount[MAX_WORDS];	// Pairs that each key comes first in
+	uint32_t	moff[MAX_WORDS + 1];	// Where they start, over all partitions
+	uint32_t	mbelow[26];		// Letters of each set and those before
+	uint32_t	mitm_passes;		// Partitions that the pairs took
+	atomic_int	mitm_next	__attribute__ ((aligned(64)));
+	atomic_int	mitm_done	__attribute__ ((aligned(64)));
+	struct mpair	mpairs[MITM_PAIRS] __attribute__ ((aligned(64)));
+	uint64_t	mheads[MITM_HEADS] __attribute__ ((aligned(64)));
+
+	// Copies of the frequency sets for the solvers on each NUMA node after
+	// the first.  See NUMA
+	struct {
+		atomic_int	state	__attribute__ ((aligned(64)));	// See REPLICA_*
+	} replica_state[MAX_NODES];
+	struct replica		replicas[MAX_NODES - 1];
+
+	// Per-reader frequency collation stats.  We set to 32, instead of just 26, to
+	// ensure readers aren't sharing CPU cache lines (which are 64 bytes wide)
+	uint32_t	cfs[MAX_READERS][32] __attribute__((aligned(64)));
+
+	// Key Hash Entries
+	// We keep keys and positions in separate array because faster to initialise
+	// An empty posmap entry is ~0, which sorts after every real word position
+	uint32_t	keymap[HASHSZ] __attribute__ ((aligned(64)));
+	uint32_t	posmap[HASHSZ] __attribute__ ((aligned(64)));
+
+	// Minimal perfect hash.  Each partition keeps its displacements from
+	// mph_disp[off], which leaves room for up to n buckets should it need
+	// to retry with more buckets
+	struct mph_part	mph_parts[MPH_PARTS] __attribute__ ((aligned(64)));
+	uint16_t	mph_disp[MAX_WORDS] __attribute__ ((aligned(64)));
+	uint32_t	mph_keys[MAX_WORDS] __attribute__ ((aligned(64)));
+	char		mph_words[MAX_WORDS << 3] __attribute__ ((aligned(64)));
+
+	atomic_int	mph_next	__attribute__ ((aligned(64)));
+	atomic_int	mph_done	__attribute__ ((aligned(64)));
+	atomic_int	mph_buckets	__attribute__ ((aligned(64)));
+	atomic_int	mph_go		__attribute__ ((aligned(64)));
+	volatile int	mph_failed;
+
+	// File reader buffers
+	char		rbufs[MAX_READERS][URING_DEPTH][READ_BUF_LEN] __attribute__ ((aligned(4096)));
+
+	struct stream_buf stream_bufs[STREAM_BUFS];
+	char		sbufs[STREAM_BUFS][STREAM_CARRY + READ_CHUNK + 64] __attribute__ ((aligned(4096)));
+
+	atomic_int	stream_filled	__attribute__ ((aligned(64)));
+	atomic_int	stream_next	__attribute__ ((aligned(64)));
+	atomic_int	stream_end	__attribute__ ((aligned(64)));	// Buffers in all, once known
+};
+
+#ifdef SOLVER_LIBRARY
+static __thread struct solver_ctx *ctx __attribute__ ((tls_model("initial-exec")));
+#else
+static struct solver_ctx solver_state[1] __attribute__ ((aligned(4096)));
+static struct solver_ctx *const ctx = solver_state;
+#endif
+
+// The counters of the solver that the thread is running as
+#ifdef SEARCH_STATS
+static __thread struct search_stats *stats __attribute__ ((unused, tls_model("initial-exec")));
+#endif
+
+static int	write_metrics = 0;
+
+#ifdef WORD_INDEX
+#define key_ref(f, kp)		((uint32_t)((kp) - (f)->tkeys))
+#define key_index(kp)		(ctx->tidx[(kp) - ctx->tkeys])
+#define copy_index(dp, sp)	(key_index(dp) = key_index(sp))
+#define swap_index(ap, bp)	do {					\
+		uint32_t _i = key_index(ap);				\
+		key_index(ap) = key_index(bp);				\
+		key_index(bp) = _i;					\
+	} while (0)
+#else
+#define key_ref(f, kp)		(*(kp))
+#define copy_index(dp, sp)
+#define swap_index(ap, bp)
+#endif
+
+// Solver kernel instruction sets.  See kernels.h
+#define KERNEL_SCALAR	0
+#define KERNEL_AVX2	1
+#define KERNEL_AVX512	2
 
 static void solve();
 static void solve_work();
@@ -103,11 +461,12 @@ print_time_taken(char *label, struct timespec *ts, struct timespec *te)
 static void
 frq_init()
 {
-	memset(frq, 0, sizeof(frq));
+	memset(ctx->frq, 0, sizeof(ctx->frq));
 
 	for (int b = 0; b < 26; b++) {
-		frq[b].sets = tiers[b];
-		frq[b].m = (1UL << b);	// The bit mask
+		ctx->frq[b].sets = ctx->tiers[b];
+		ctx->frq[b].tkeys = ctx->tkeys;
+		ctx->frq[b].m = (1UL << b);	// The bit mask
 	}
 } // frq_init
 
@@ -128,23 +487,192 @@ get_nthreads()
 	if (ncpus < 9)
 		return ncpus - 1;
 
-	// Generally speaking, not much to be gained beyond 20 threads
-	if ((ncpus - 2) > 20)
-		return 20;
+	// The solvers steal work from each other, so keep on scaling
+	if ((ncpus - 2) > MAX_THREADS)
+		return MAX_THREADS;
 
 	return ncpus - 2;
 } // get_nthreads
 
-// Given a 5 letter word, calculate the bit-map representation of that word
+//********************* CPU AFFINITY **********************
+
+// With -a, thread n is pinned to cpu_order[n], where the main thread is
+// thread 0.  It gets the first core to itself while process_words() runs,
+// then come the other physical cores, then their SMT siblings, and the
+// siblings of the main thread's core come last of all
+
+#define MAX_CPUS	1024
+
+static int	pin_threads = 0;
+static int	num_pin_cpus = 0;
+static int	cpu_order[MAX_CPUS];
+
+// Reads a number from the sysfs topology of cpu.  Returns -1 if there isn't one
+static int
+cpu_topology(int cpu, const char *name)
+{
+	char path[128], buf[32];
+	int fd, len, val = -1;
+
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, name);
+	if ((fd = open(path, O_RDONLY)) >= 0) {
+		if ((len = read(fd, buf, sizeof(buf) - 1)) > 0) {
+			buf[len] = '\0';
+			val = atoi(buf);
+		}
+		close(fd);
+	}
+	return val;
+} // cpu_topology
+
+// Works out the order to pin threads in, from the CPUs we're allowed to use
+void
+affinity_init()
+{
+	uint64_t allowed[MAX_CPUS / 64];
+	struct cpu {
+		int	rank;		// 0 for the first CPU of a core, 1 for the next...
+		int	pkg, core, cpu;
+	} c[MAX_CPUS], t;
+	int n = 0;
+
+	// We may be limited to some of the CPUs, such as by taskset
+	memset(allowed, 0, sizeof(allowed));
+	if (syscall(SYS_sched_getaffinity, 0, sizeof(allowed), allowed) < 0)
+		return;
+
+	for (int cpu = 0; cpu < MAX_CPUS; cpu++) {
+		if (!(allowed[cpu >> 6] & (1ULL << (cpu & 63))))
+			continue;
+
+		c[n].cpu = cpu;
+		c[n].pkg = cpu_topology(cpu, "physical_package_id");
+		if ((c[n].core = cpu_topology(cpu, "core_id")) < 0)
+			c[n].core = cpu;
+		c[n].rank = 0;
+		for (int i = 0; i < n; i++)
+			if ((c[i].pkg == c[n].pkg) && (c[i].core == c[n].core))
+				c[n].rank++;
+		n++;
+	}
+
+	// The main thread gets the first CPU, so its core's siblings go last
+	for (int i = 1; i < n; i++)
+		if ((c[i].pkg == c[0].pkg) && (c[i].core == c[0].core))
+			c[i].rank = MAX_CPUS;
+
+	// Insertion sort by rank, and then by package and core
+	for (int i = 1; i < n; i++) {
+		int j;
+
+		t = c[i];
+		for (j = i; j > 0; j--) {
+			struct cpu *p = c + j - 1;
+
+			if ((p->rank < t.rank) || ((p->rank == t.rank) &&
+			    ((p->pkg < t.pkg) || ((p->pkg == t.pkg) && (p->core <= t.core)))))
+				break;
+			c[j] = *p;
+		}
+		c[j] = t;
+	}
+
+	for (int i = 0; i < n; i++)
+		cpu_order[i] = c[i].cpu;
+	num_pin_cpus = n;
+} // affinity_init
+
+// Pins the calling thread, which is thread n, if we're pinning threads
+void
+pin_thread(int n)
+{
+	uint64_t mask[MAX_CPUS / 64];
+
+	if (!pin_threads || (num_pin_cpus == 0))
+		return;
+
+	int cpu = cpu_order[n % num_pin_cpus];
+
+	memset(mask, 0, sizeof(mask));
+	mask[cpu >> 6] = 1ULL << (cpu & 63);
+	if (syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) < 0)
+		perror("sched_setaffinity");
+} // pin_thread
+
+//********************* THREAD HAND-OFFS **********************
+
+// Threads hand off to each other through atomic ints.  A waiter polls for up
+// to spin_budget times, as most hand-offs are over within microseconds, and
+// then sleeps on a futex, so that when there are more threads than free CPUs
+// it doesn't burn the CPU that the thread it waits on needs.  Wakers only
+// make the futex syscall when some thread is asleep.  Set with -s
+
+#ifndef SPIN_BUDGET
+#define SPIN_BUDGET	20000
+#endif
+
+static atomic_int	num_sleepers = 0;
+
+// Waits for *addr to be other than val, and returns what it now is
+static int
+wait_change(atomic_int *addr, int val)
+{
+	int v;
+
+	for (int i = 0; i < ctx->spin_budget; i++) {
+		if ((v = atomic_load(addr)) != val)
+			return v;
+		asm("nop");
+	}
+
+	// The futex only sleeps if *addr is still val, and anyone who
+	// changes it after that sees us in num_sleepers and wakes us
+	while ((v = atomic_load(addr)) == val) {
+		atomic_fetch_add(&num_sleepers, 1);
+		syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+		atomic_fetch_sub(&num_sleepers, 1);
+	}
+	return v;
+} // wait_change
+
+// Waits for the count at *addr to reach target
+static inline void
+wait_for(atomic_int *addr, int target)
+{
+	for (int v; (v = atomic_load(addr)) < target; )
+		wait_change(addr, v);
+} // wait_for
+
+static inline void
+wake_waiters(atomic_int *addr)
+{
+	if (atomic_load(&num_sleepers))
+		syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+} // wake_waiters
+
+static inline void
+handoff_store(atomic_int *addr, int val)
+{
+	atomic_store(addr, val);
+	wake_waiters(addr);
+} // handoff_store
+
+static inline void
+handoff_add(atomic_int *addr, int n)
+{
+	atomic_fetch_add(addr, n);
+	wake_waiters(addr);
+} // handoff_add
+
+// Given a WORD_LEN letter word, calculate the bit-map representation of that
+// word.  The loop has a constant trip count, so the compiler fully unrolls it
 static inline uint32_t
 calc_key(const char *wd)
 {
-	uint32_t one = 1, mask = 0x1F;
-	uint32_t key = (one << (wd[0] & mask)) |
-                       (one << (wd[1] & mask)) |
-                       (one << (wd[2] & mask)) |
-                       (one << (wd[3] & mask)) |
-                       (one << (wd[4] & mask));
+	uint32_t one = 1, mask = 0x1F, key = 0;
+
+	for (int i = 0; i < WORD_LEN; i++)
+		key |= (one << (wd[i] & mask));
 	return key >> 1;
 } // calc_key
 
@@ -152,39 +680,55 @@ calc_key(const char *wd)
 
 // A very simple for-purpose hash map implementation.  Used to
 // lookup words given the key representation of that word
-// I've included 3 decent key_hash() functions here. All should
+// I've included 3 decent key hash functions here. All should
 // work decently for most English 5-letter words @ HASHBITS = 15
+// Use hash_bench to compare them for other word files and sizes
 
-#define	HASHSZ          (1 << HASHBITS)
-#define HASHMASK        (HASHSZ - 1)
-#define key_hash(x)	(((x * 5287) ^ (x >> 11)) & HASHMASK)
-//#define key_hash(x)	(((x * 13334) ^ x ^ (x >> 12)) & HASHMASK)
-//#define key_hash(x)	(x ^ (x >> 6) ^ (x >> 10) ^ (~x >> 1)) & HASHMASK
-
-// Key Hash Entries
-// We keep keys and positions in separate array because faster to initialise
-uint32_t keymap[HASHSZ] __attribute__ ((aligned(64)));
-uint32_t posmap[HASHSZ] __attribute__ ((aligned(64)));
+#define KEY_HASH_5287(x)	((x * 5287) ^ (x >> 11))
+#define KEY_HASH_13334(x)	((x * 13334) ^ x ^ (x >> 12))
+#define KEY_HASH_SHIFTS(x)	(x ^ (x >> 6) ^ (x >> 10) ^ (~x >> 1))
+#define key_hash(x)	(KEY_HASH_5287(x) & HASHMASK)
 
 static void
 hash_init()
 {
-	memset(keymap, 0, sizeof(keymap));
+	memset(ctx->keymap, 0, sizeof(ctx->keymap));
+	memset(ctx->posmap, 0xff, sizeof(ctx->posmap));
 } // hash_init
 
+// Returns the WORD_LEN letters of the word at words[off] as a number that
+// sorts the same way that the words do alphabetically
+static inline uint64_t
+word_order(uint32_t off)
+{
+	return __builtin_bswap64(*(uint64_t *)(ctx->words + off)) >> (64 - (WORD_LEN << 3));
+} // word_order
+
+// The reader threads all insert into the hash table concurrently.  A key is
+// claimed by a CAS into an empty keymap slot.  All anagrams share the one key,
+// and we always keep the alphabetically first of them, no matter which reader
+// got there first, by doing a CAS-min of the word position into posmap.  The
+// word itself must already be in words[pos << 3].  Returns 1 for a new key
 uint32_t
 hash_insert(uint32_t key, uint32_t pos)
 {
-	uint32_t col = 0, hashpos = key_hash(key);
+	uint32_t col = 0, hashpos = key_hash(key), new = 0;
 
 	do {
-		// Check if we can insert at this position
-		if (keymap[hashpos] == 0)
+		uint32_t cur = __atomic_load_n(ctx->keymap + hashpos, __ATOMIC_RELAXED);
+
+		// Check if we can insert at this position.  If we lose
+		// the race for it, cur gets the key that won
+		if ((cur == 0) &&
+		    __atomic_compare_exchange_n(ctx->keymap + hashpos, &cur, key, 0,
+						__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			new = 1;
 			break;
+		}
 
 		// Check if duplicate key
-		if (keymap[hashpos] == key)
-			return 0;
+		if (cur == key)
+			break;
 
 		if (++hashpos == HASHSZ)
 			hashpos = 0;
@@ -192,13 +736,19 @@ hash_insert(uint32_t key, uint32_t pos)
 		col++;
 	} while (1);
 
-	// Now insert at hash location
-	keymap[hashpos] = key;
-	posmap[hashpos] = pos << 3;
+	// Keep the alphabetically first word for this key
+	uint32_t off = pos << 3, cur = __atomic_load_n(ctx->posmap + hashpos, __ATOMIC_ACQUIRE);
+	uint64_t ord = word_order(off);
 
-	hash_collisions += col;
+	while ((cur == ~0U) || (ord < word_order(cur)))
+		if (__atomic_compare_exchange_n(ctx->posmap + hashpos, &cur, off, 0,
+						__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			break;
 
-	return 1;
+	if (new && col)
+		atomic_fetch_add(&ctx->hash_collisions, col);
+
+	return new;
 } // hash_insert
 
 const char *
@@ -208,21 +758,257 @@ hash_lookup(uint32_t key)
 
 	do {
 		// Check for a match
-		if (keymap[hashpos] == key)
+		if (ctx->keymap[hashpos] == key)
 			break;
 
 		// Check the not-in-hash scenario
-		if (keymap[hashpos] == 0)
+		if (ctx->keymap[hashpos] == 0)
 			return NULL;
 
 		if (++hashpos == HASHSZ)
 			hashpos = 0;
 	} while (1);
 
-	return words + posmap[hashpos];
+	return ctx->words + ctx->posmap[hashpos];
 } // hash_lookup
 #undef key_hash
 
+//********************* MINIMAL PERFECT HASH **********************
+
+// Once the words are loaded the key set never changes, so with -p we also
+// build a minimal perfect hash over it, CHD style.  The keys are split into
+// MPH_PARTS partitions, so that the worker threads can each build different
+// partitions at the same time.  Within a partition of n keys, the keys are
+// hashed into buckets of ~MPH_LAMBDA keys, and each bucket gets a 16-bit
+// displacement (d0, d1) that puts a key with hash values A and B into slot
+// (A + d0 * B + d1) % n.  Largest buckets first, we look for a displacement
+// that lands all of a bucket's keys on free slots.  For a given d0, the d1
+// values that work come from ANDing together the free slots bitmap rotated
+// by where each key lands, so there's no trial and error over d1.  Two
+// keys in a bucket with the same A and B can never be placed, so should that
+// happen the partition is re-tried with a new seed for A and B.
+// A lookup is one displacement fetch and one word fetch, with no probing,
+// and the words plus displacements take ~9 bytes per key instead of the
+// 256KB of keymap and posmap
+
+// Reduces x to [0..n) without a divide
+#define fastrange32(x, n)	((uint32_t)(((uint64_t)(x) * (n)) >> 32))
+
+// x % n without a divide, given m = (~0ULL / n) + 1
+#define fastmod32(x, m, n)	((uint32_t)(((unsigned __int128)((m) * (x)) * (n)) >> 64))
+
+// The top MPH_PART_BITS of the hash pick the partition, and the next 26 bits
+// pick the bucket.  A and B are 16 bits each from a re-mix of the hash with
+// the partition's seed, so that A + d0 * B + d1 always fits into 32 bits
+static inline uint64_t
+mph_hash(uint32_t key)
+{
+	uint64_t h = key * 0x9E3779B97F4A7C15ULL;
+
+	h ^= h >> 32;
+	h *= 0xD6E8FEB86659FD93ULL;
+	return h ^ (h >> 32);
+} // mph_hash
+
+#define mph_part_of(h)		(ctx->mph_parts + ((h) >> (64 - MPH_PART_BITS)))
+#define mph_bucket(h, nb)	fastrange32((uint32_t)((h) >> 32) << MPH_PART_BITS, nb)
+#define mph_ab(h, p)		((uint32_t)((((h) ^ (p)->seed) * 0xBF58476D1CE4E5B9ULL) >> 32))
+#define mph_slot(h, d, p)	fastmod32((mph_ab(h, p) & 0xFFFF) +			\
+					  ((d) >> MPH_D1_BITS) * (mph_ab(h, p) >> 16) +	\
+					  ((d) & (MPH_MAX_PART - 1)), (p)->m, (p)->n)
+
+static inline const char *
+mph_lookup(uint32_t key)
+{
+	uint64_t h = mph_hash(key);
+	struct mph_part *p = mph_part_of(h);
+	uint32_t d = ctx->mph_disp[p->off + mph_bucket(h, p->nb)];
+
+	return ctx->mph_words + ((p->off + mph_slot(h, d, p)) << 3);
+} // mph_lookup
+
+// Returns the 64 bits of bitmap bm starting at bit pos
+static inline uint64_t
+mph_bits(uint64_t *bm, uint32_t pos)
+{
+	uint32_t w = pos >> 6, r = pos & 63;
+
+	return r ? (bm[w] >> r) | (bm[w + 1] << (64 - r)) : bm[w];
+} // mph_bits
+
+// Try to place all the keys of partition p using nb buckets.  Returns 0 if
+// a bucket was found that no displacement could place
+static int
+mph_place(struct mph_part *p, uint32_t nb)
+{
+	uint32_t n = p->n, *pk = ctx->mph_keys + p->off, maxsz = 0, nw = (n + 63) >> 6;
+	uint32_t cnt[MPH_MAX_PART + 1], start[MPH_MAX_PART + 1];
+	uint32_t bk[MPH_MAX_PART], base[MPH_MAX_PART];
+	uint64_t bh[MPH_MAX_PART], fit[MPH_MAX_PART / 64];
+	uint16_t *disp = ctx->mph_disp + p->off;
+
+	// The free slots bitmap is kept twice over, end to end, so that
+	// the free slots at any rotation can be read straight out of it
+	uint64_t free[(MPH_MAX_PART / 32) + 2];
+	memset(free, 0, sizeof(free));
+	for (uint32_t i = 0; i < (n << 1); i++)
+		free[i >> 6] |= (1ULL << (i & 63));
+
+	// Sort the keys into their buckets
+	memset(cnt, 0, nb * sizeof(*cnt));
+	for (uint32_t i = 0; i < n; i++)
+		cnt[mph_bucket(mph_hash(pk[i]), nb)]++;
+	for (uint32_t b = 0, pos = 0; b < nb; pos += cnt[b++]) {
+		start[b] = pos;
+		if (cnt[b] > maxsz)
+			maxsz = cnt[b];
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		uint64_t h = mph_hash(pk[i]);
+		uint32_t pos = start[mph_bucket(h, nb)]++;
+
+		bk[pos] = pk[i];
+		bh[pos] = h;
+	}
+	for (uint32_t b = 0; b < nb; b++)
+		start[b] -= cnt[b];
+
+	// Place the largest buckets first, while there's the most room
+	memset(disp, 0, nb * sizeof(*disp));
+	for (uint32_t sz = maxsz; sz > 0; sz--)
+		for (uint32_t b = 0; b < nb; b++) {
+			if (cnt[b] != sz)
+				continue;
+
+			uint64_t *hp = bh + start[b];
+			uint32_t d0, d1 = n, i, j;
+
+			for (d0 = 0; (d1 == n) && (d0 < MPH_MAX_D0); d0++) {
+				// Where each key lands with d1 = 0.  Keys that
+				// land together here will land together for all d1
+				for (i = 0; i < sz; i++) {
+					base[i] = mph_slot(hp[i], d0 << MPH_D1_BITS, p);
+					for (j = 0; (j < i) && (base[j] != base[i]); j++);
+					if (j < i)
+						break;
+				}
+				if (i < sz)
+					continue;
+
+				// Bit d1 of fit ends up set if every key in the
+				// bucket lands on a free slot when shifted by d1
+				for (uint32_t w = 0; w < nw; w++) {
+					fit[w] = ~0ULL;
+					for (i = 0; i < sz; i++)
+						fit[w] &= mph_bits(free, base[i] + (w << 6));
+				}
+				if (n & 63)
+					fit[nw - 1] &= (1ULL << (n & 63)) - 1;
+
+				for (uint32_t w = 0; w < nw; w++)
+					if (fit[w]) {
+						d1 = (w << 6) + __builtin_ctzll(fit[w]);
+						break;
+					}
+			}
+			if (d1 == n)
+				return 0;
+			disp[b] = ((d0 - 1) << MPH_D1_BITS) | d1;
+
+			for (i = 0; i < sz; i++) {
+				uint32_t slot = base[i] + d1;
+
+				slot -= (slot >= n) ? n : 0;
+				free[slot >> 6] &= ~(1ULL << (slot & 63));
+				slot += n;
+				free[slot >> 6] &= ~(1ULL << (slot & 63));
+			}
+		}
+
+	// Everything fits, so now copy in the words
+	p->nb = nb;
+	for (uint32_t i = 0; i < n; i++) {
+		uint64_t h = bh[i];
+		uint32_t slot = mph_slot(h, disp[mph_bucket(h, nb)], p);
+
+		*(uint64_t *)(ctx->mph_words + ((p->off + slot) << 3)) = *(uint64_t *)hash_lookup(bk[i]);
+	}
+	return 1;
+} // mph_place
+
+// Splits the final key set into partitions.  This is quick, and then
+// the partitions get built by whichever threads get to them first
+void
+mph_layout()
+{
+	uint32_t cnt[MPH_PARTS] = {0}, pos[MPH_PARTS];
+
+	for (uint32_t *kp = ctx->keys, key; (key = *kp++); )
+		cnt[mph_hash(key) >> (64 - MPH_PART_BITS)]++;
+
+	for (uint32_t p = 0, off = 0; p < MPH_PARTS; off += cnt[p++]) {
+		ctx->mph_parts[p].off = pos[p] = off;
+		ctx->mph_parts[p].n = cnt[p];
+		ctx->mph_parts[p].m = cnt[p] ? (~0ULL / cnt[p]) + 1 : 0;
+		if (cnt[p] > MPH_MAX_PART)
+			ctx->mph_failed = 1;
+	}
+
+	for (uint32_t *kp = ctx->keys, key; (key = *kp++); )
+		ctx->mph_keys[pos[mph_hash(key) >> (64 - MPH_PART_BITS)]++] = key;
+
+	handoff_store(&ctx->mph_go, 1);
+} // mph_layout
+
+void
+mph_build_parts()
+{
+	wait_change(&ctx->mph_go, 0);
+
+	for (int pn; (pn = atomic_fetch_add(&ctx->mph_next, 1)) < MPH_PARTS; ) {
+		struct mph_part *p = ctx->mph_parts + pn;
+		uint32_t nb = (p->n + MPH_LAMBDA - 1) / MPH_LAMBDA, tries = 0;
+
+		// If a partition won't place, retry it with a new seed,
+		// and then also with more buckets if that doesn't help
+		if (!ctx->mph_failed && p->n)
+			while (!mph_place(p, nb)) {
+				p->seed += 0x9E3779B97F4A7C15ULL;
+				if ((++tries & 3) == 0)
+					nb += (nb >> 1) + 1;
+				if (nb > p->n) {
+					ctx->mph_failed = 1;
+					break;
+				}
+			}
+
+		atomic_fetch_add(&ctx->mph_buckets, p->nb);
+		handoff_add(&ctx->mph_done, 1);
+	}
+} // mph_build_parts
+
+// The main thread builds any partitions that the workers haven't got to, and
+// then waits for the rest.  We fall back to the hash table if it didn't work
+void
+mph_build()
+{
+	mph_build_parts();
+
+	wait_for(&ctx->mph_done, MPH_PARTS);
+
+	if (ctx->mph_failed) {
+		fprintf(stderr, "WARNING: Unable to build the perfect hash\n");
+		ctx->use_mph = 0;
+	}
+} // mph_build
+
+// Finds the word for a key that is known to be in the key set
+static inline const char *
+word_lookup(uint32_t key)
+{
+	return ctx->use_mph ? mph_lookup(key) : hash_lookup(key);
+} // word_lookup
+
 // Just a handy debugging function which was used when developing the
 // 5 letter word extraction bit masking algorithm within find_words()
 void
@@ -255,33 +1041,81 @@ print_bits(char *label, uint64_t v)
 
 // ********************* FILE READER ********************
 
-#define READ_CHUNK        65536		// Appears to be optimum
-
-void
-find_words(char *s, char *e, uint32_t rn)
+// Given the non-letter mask of the 64 characters starting at s, add all the
+// WORD_LEN letter words with unique letters to the fives list, and return
+// where the next vector pass should start from
+static inline __attribute__((always_inline)) char *
+find_fives_in_mask(char *s, uint64_t wmask, char ***fivepp)
 {
-	char *fives[(READ_CHUNK / 6) + 1] __attribute__((aligned(64)));
-	char **fivep = fives;
-	char a = 'a', z = 'z';
 	int64_t msbset = 0x8000000000000000;
-	uint32_t *cf = cfs[rn];
+	char **fivep = *fivepp;
+
+	// Handle lines over 64 characters in length.  Jump ahead just
+	// far enough such that we won't accidentally feed the last WORD_LEN
+	// characters from an overly long line into the next pass
+	// !wmask is never true for words_alpha.txt, so the CPU branch
+	// predictor should never get this wrong
+	if (!wmask)
+		return s + (64 - (WORD_LEN + 1));
+
+	// Calculate where to start the next loop pass and invalidate
+	// everything after the last non-lower case letter
+	char *ns = s + 64;
+	uint32_t nlz = __builtin_clzll(wmask);
+	ns -= nlz;
+	wmask |= (msbset >> nlz);
+
+	// Get the 1's complement of wmask. ocwm will have a 1-bit set
+	// for every valid lower-case letter than was in the vector.
+	uint64_t ocwm = ~wmask;
+
+	// Isolate all words of <=WORD_LEN characters
+	wmask = (wmask >> WORD_LEN) & ((wmask << 1) | 1);
+
+	// Keep only the bits that start a run of WORD_LEN letters
+	uint64_t run = ocwm;
+	for (int i = 1; i < WORD_LEN; i++)
+		run &= (ocwm >> i);
+
+	// Intersect the two
+	wmask &= run;
+
+	// wmask will now contain a 1 bit located at the
+	// start of every word with exactly WORD_LEN letters
+
+	// Process all WORD_LEN letter words in the vector
+	while (wmask) {
+		// Get a pointer to the start of the word
+		char *w = s + __builtin_ctzll(wmask);
+
+		// Add word to our list
+		*fivep = w;
+
+		// Advance list if word has no duplicate characters
+		fivep += (__builtin_popcount(calc_key(w)) == WORD_LEN);
+
+		// Unset the lowest bit
+		wmask &= (wmask - 1);
+	}
+
+	*fivepp = fivep;
+	return ns;
+} // find_fives_in_mask
 
-#ifdef __AVX2__
-	// AVX512 is about 10% faster than AVX2 for processing the words
-	// Use AVX512 if the current platform supports it
+// The vector loops of find_words().  They return where the scalar loop must
+// resume from.  Each carries its own target attribute so that the runtime
+// dispatched build can hold both, and bind the best one in select_kernels()
 
+#if defined(__AVX512BW__) || defined(RUNTIME_DISPATCH)
+// AVX512 is about 10% faster than AVX2 for processing the words
+static __attribute__((target("avx512f,avx512bw,bmi,lzcnt,popcnt"))) char *
+find_fives_avx512(char *s, char *e, char ***fivepp)
+{
 	// Prepare 2 constant vectors with all a's and all z's
-#ifdef __AVX512F__
-	__m512i avec = _mm512_set1_epi8(a);
-	__m512i zvec = _mm512_set1_epi8(z);
-#else
-	__m256i avec = _mm256_set1_epi8(a);
-	__m256i zvec = _mm256_set1_epi8(z);
-#endif
+	__m512i avec = _mm512_set1_epi8('a');
+	__m512i zvec = _mm512_set1_epi8('z');
 
-	e -= 64;
-	while (s < e) {
-#ifdef __AVX512F__
+	for (e -= 64; s < e; ) {
 		// Unaligned load of a vector with the next 64 characters
 		__m512i wvec = _mm512_loadu_si512((const __m512i_u *)s);
 
@@ -289,8 +1123,22 @@ find_words(char *s, char *e, uint32_t rn)
 		// wmask will have a 0-bit for every lower-case letter in the vector
 		uint64_t wmask = _mm512_cmp_epi8_mask(wvec, avec, _MM_CMPINT_LT) |
 					  _mm512_cmp_epi8_mask(zvec, wvec, _MM_CMPINT_LT);
-#else
-		// Here we're in AVX2 mode.  Emulate AVX512 mode by doing 2 loads
+
+		s = find_fives_in_mask(s, wmask, fivepp);
+	}
+	return s;
+} // find_fives_avx512
+#endif
+
+#if (defined(__AVX2__) && !defined(__AVX512BW__)) || defined(RUNTIME_DISPATCH)
+static __attribute__((target("avx2,bmi,lzcnt,popcnt"))) char *
+find_fives_avx2(char *s, char *e, char ***fivepp)
+{
+	__m256i avec = _mm256_set1_epi8('a');
+	__m256i zvec = _mm256_set1_epi8('z');
+
+	for (e -= 64; s < e; ) {
+		// Emulate AVX512 mode by doing 2 loads
 
 		// Unaligned load of 2 vectors with the next 64 characters
 		__m256i wvec1 = _mm256_loadu_si256((const __m256i_u *)s);
@@ -309,119 +1157,548 @@ find_words(char *s, char *e, uint32_t rn)
 
 		// Merge the results of the two loads
 		wmask = (wmask << 32) | wmask1;
-#endif
-		// Handle lines over 64 characters in length.  Jump ahead just
-		// far enough such that we won't accidentally feed the last 5
-		// characters from an overly long line into the next pass
-		// !wmask is never true for words_alpha.txt, so the CPU branch
-		// predictor should never get this wrong
-		if (!wmask) {
-			s += 58;
-			continue;
-		}
-
-		// Calculate where to start the next loop pass and invalidate
-		// everything after the last non-lower case letter
-		char *ns = s + 64;
-		uint32_t nlz = __builtin_clzll(wmask);
-		ns -= nlz;
-		wmask |= (msbset >> nlz);
-
-		// Get the 1's complement of wmask. ocwm will have a 1-bit set
-		// for every valid lower-case letter than was in the vector.
-		uint64_t ocwm = ~wmask;
-
-		// Isolate all words of <=5 characters
-		wmask = (wmask >> 5) & ((wmask << 1) | 1);
-
-		// Reset bit 0 in all words with less than 5 characters
-		ocwm = ((ocwm >> 1) & (ocwm >> 2));
 
-		// Intersect the two
-		wmask &= (ocwm & (ocwm >> 2));
-
-		// wmask will now contain a 1 bit located at the
-		// start of every word with exactly 5 letters
-
-		// Process all 5 letter words in the vector
-		while (wmask) {
-			// Get a pointer to the start of the 5 letter word
-			char *w = s + __builtin_ctzll(wmask);
-
-			// Add word to our list
-			*fivep = w;
+		s = find_fives_in_mask(s, wmask, fivepp);
+	}
+	return s;
+} // find_fives_avx2
+#endif
 
-			// Advance list if word has no duplicate characters
-			fivep += (__builtin_popcount(calc_key(w)) == 5);
+#ifdef RUNTIME_DISPATCH
+// Bound by select_kernels().  NULL means just use the scalar loop
+static char *(*find_fives)(char *s, char *e, char ***fivepp) = NULL;
+#endif
 
-			// Unset the lowest bit
-			wmask &= (wmask - 1);
-		}
-		s = ns;
-	}
-	e += 64;
+void
+find_words(char *s, char *e, uint32_t rn)
+{
+	char *fives[(READ_CHUNK / (WORD_LEN + 1)) + 1] __attribute__((aligned(64)));
+	char **fivep = fives;
+	char a = 'a', z = 'z';
+	uint32_t *cf = ctx->cfs[rn];
+
+	// Vector code finds most of the words
+#if defined(RUNTIME_DISPATCH)
+	if (find_fives)
+		s = find_fives(s, e, &fivep);
+#elif defined(__AVX512BW__)
+	s = find_fives_avx512(s, e, &fivep);
+#elif defined(__AVX2__)
+	s = find_fives_avx2(s, e, &fivep);
 #endif
 
-	// Scalar code to find 5 words. This also
-	// handles residuals from the vector loop
+	// Scalar code to find WORD_LEN letter words. This
+	// also handles residuals from the vector loop
 	for (char c, *w = s; s < e; w = s) {
-		c = *s++; if ((c < a) || (c > z)) continue;
-		c = *s++; if ((c < a) || (c > z)) continue;
-		c = *s++; if ((c < a) || (c > z)) continue;
-		c = *s++; if ((c < a) || (c > z)) continue;
-		c = *s++; if ((c < a) || (c > z)) continue;
+		int n;
+
+		for (n = 0; n < WORD_LEN; n++) {
+			c = *s++;
+			if ((c < a) || (c > z))
+				break;
+		}
+		if (n < WORD_LEN)
+			continue;
 
-		// We've now found 5 [a..z] characters in a row
+		// We've now found WORD_LEN [a..z] characters in a row
 		c = *s++;
 		if ((c < a) || (c > z))  {
 			*fivep = w;
-			fivep += (__builtin_popcount(calc_key(w)) == 5);
+			fivep += (__builtin_popcount(calc_key(w)) == WORD_LEN);
 		}
 
-		// Just quickly find the next line
-		while (c != '\n')
+		// Just quickly find the next line.  We stop at e, as there is
+		// nothing more to find on this line, and a last line that has
+		// no newline would otherwise have us run off the end of a file
+		while ((c != '\n') && (s < e))
 			c = *s++;
 	}
 
-	// Bulk process all found unique 5 words
+	// Bulk process all found unique letter words
 	// If no words to process, return now
 	int num = fivep - fives;
 	if (num == 0)
 		return;
 
-	// Bulk reserve where to place the words
-	int pos = atomic_fetch_add(&num_words, num);
+	// Bulk reserve where to place the words.  We re-use the fives
+	// list to collect any new keys that this reader inserts
+	int pos = atomic_fetch_add(&ctx->num_words, num);
+	uint32_t *newkeys = (uint32_t *)fives, *nk = newkeys;
 	fivep = fives;
 	while (num--) {
 		char *w = *fivep++;
 
 		// Copy word to word table as a single 64-bit copy
-		*(uint64_t *)(words + (pos << 3)) = *(uint64_t *)w;
+		*(uint64_t *)(ctx->words + (pos << 3)) = *(uint64_t *)w;
 
-		// Copy key to wordkeys array
+		// Insert the key, and keep it if it's new
 		uint32_t key = calc_key(w);
-		wordkeys[pos++] = key;
+		*nk = key;
+		nk += hash_insert(key, pos++);
 
 		// Get character frequencies
-		cf[__builtin_ctz(key)]++; key &= key - 1;
-		cf[__builtin_ctz(key)]++; key &= key - 1;
-		cf[__builtin_ctz(key)]++; key &= key - 1;
-		cf[__builtin_ctz(key)]++; key &= key - 1;
-		cf[__builtin_ctz(key)]++;
+		for (int i = 0; i < WORD_LEN; i++) {
+			cf[__builtin_ctz(key)]++;
+			key &= key - 1;
+		}
 	}
+
+	// Bulk add the new keys to the key set
+	if ((num = nk - newkeys) > 0)
+		memcpy(ctx->keys + atomic_fetch_add(&ctx->num_keys, num), newkeys, num * sizeof(*ctx->keys));
 } // find_words
 
+// File reader back-ends.  mmap() lets the readers page-fault their way
+// through the file, whereas pread and uring read each chunk into one of a
+// reader's own pre-allocated buffers before finding the words in it.  The
+// stream back-end is used for pipes and stdin, which can only be read once
+// and in order
+#define READER_MMAP	0
+#define READER_PREAD	1
+#define READER_URING	2
+#define READER_STREAM	3
+
+static inline uint64_t
+get_ns()
+{
+	struct timespec ts[1];
+
+	clock_gettime(CLOCK_MONOTONIC, ts);
+	return (ts->tv_sec * 1000000000ULL) + ts->tv_nsec;
+} // get_ns
+
+// Finds the words in a chunk that was read into a buffer from file offset off
+static void
+find_words_in_buffer(char *buf, ssize_t n, off_t off, uint32_t rn)
+{
+	char *s = buf, *e = buf + n;
+
+	// A short read only happens at the end of the file, so this newline
+	// is where the data truly ends.  It also stops find_words() from
+	// running off the end of the buffer on a line longer than READ_TAIL
+	buf[n] = '\n';
+
+	// As per the mmap() reader, overlap the next chunk by 1 character,
+	// and only start after a newline if not at the start of the file
+	if (n > (READ_CHUNK + 1))
+		e = buf + (READ_CHUNK + 1);
+
+	if (off > 0)
+		while ((s < e) && (*s++ != '\n'));
+
+	find_words(s, e, rn);
+} // find_words_in_buffer
+
+// Reads up to len bytes at off, only returning less at the end of the file
+static ssize_t
+pread_full(char *buf, size_t len, off_t off)
+{
+	ssize_t ret, n = 0;
+
+	while (n < len) {
+		ret = pread(ctx->read_fd, buf + n, len - n, off + n);
+		if (ret == 0)
+			break;
+		if (ret < 0) {
+			perror("pread");
+			exit(EXIT_FAILURE);
+		}
+		n += ret;
+	}
+	return n;
+} // pread_full
+
+static void
+file_reader_pread(struct worker *work)
+{
+	uint32_t rn = work - ctx->workers;
+	char *buf = ctx->rbufs[rn][0];
+	off_t off;
+
+	while ((off = atomic_fetch_add(&ctx->file_pos, READ_CHUNK)) < ctx->read_len) {
+		uint64_t t1 = write_metrics ? get_ns() : 0;
+
+		ssize_t n = pread_full(buf, READ_LEN, off);
+
+		uint64_t t2 = write_metrics ? get_ns() : 0;
+
+		find_words_in_buffer(buf, n, off, rn);
+
+		if (write_metrics) {
+			work->io_ns += t2 - t1;
+			work->scan_ns += get_ns() - t2;
+			work->chunks++;
+		}
+	}
+} // file_reader_pread
+
+#ifdef HAVE_IO_URING
+
+// A minimal io_uring, driven directly through the system calls
+struct uring {
+	int			fd;
+	uint32_t		*sq_tail;
+	uint32_t		*sq_array;
+	uint32_t		sq_mask;
+	uint32_t		sq_next;	// Next SQ tail to publish
+	uint32_t		to_submit;
+	uint32_t		*cq_head;
+	uint32_t		*cq_tail;
+	uint32_t		cq_mask;
+	struct io_uring_sqe	*sqes;
+	struct io_uring_cqe	*cqes;
+	void			*sq_ring, *cq_ring;
+	size_t			sq_sz, cq_sz, sqes_sz;
+};
+
+static int
+uring_init(struct uring *r, uint32_t entries)
+{
+	struct io_uring_params p[1];
+
+	memset(p, 0, sizeof(p));
+	memset(r, 0, sizeof(*r));
+
+	if ((r->fd = syscall(__NR_io_uring_setup, entries, p)) < 0)
+		return -1;
+
+	r->sq_sz = p->sq_off.array + (p->sq_entries * sizeof(uint32_t));
+	r->cq_sz = p->cq_off.cqes + (p->cq_entries * sizeof(struct io_uring_cqe));
+	if (p->features & IORING_FEAT_SINGLE_MMAP) {
+		if (r->cq_sz > r->sq_sz)
+			r->sq_sz = r->cq_sz;
+		r->cq_sz = r->sq_sz;
+	}
+	r->sqes_sz = p->sq_entries * sizeof(struct io_uring_sqe);
+
+	r->sq_ring = mmap(NULL, r->sq_sz, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+	if (r->sq_ring == MAP_FAILED)
+		goto uring_init_fail;
+
+	if (p->features & IORING_FEAT_SINGLE_MMAP) {
+		r->cq_ring = r->sq_ring;
+	} else {
+		r->cq_ring = mmap(NULL, r->cq_sz, PROT_READ | PROT_WRITE,
+				  MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+		if (r->cq_ring == MAP_FAILED)
+			goto uring_init_fail;
+	}
+
+	r->sqes = mmap(NULL, r->sqes_sz, PROT_READ | PROT_WRITE,
+		       MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+	if (r->sqes == MAP_FAILED)
+		goto uring_init_fail;
+
+	r->sq_tail  = (uint32_t *)((char *)r->sq_ring + p->sq_off.tail);
+	r->sq_array = (uint32_t *)((char *)r->sq_ring + p->sq_off.array);
+	r->sq_mask  = *(uint32_t *)((char *)r->sq_ring + p->sq_off.ring_mask);
+	r->sq_next  = *r->sq_tail;
+	r->cq_head  = (uint32_t *)((char *)r->cq_ring + p->cq_off.head);
+	r->cq_tail  = (uint32_t *)((char *)r->cq_ring + p->cq_off.tail);
+	r->cq_mask  = *(uint32_t *)((char *)r->cq_ring + p->cq_off.ring_mask);
+	r->cqes     = (struct io_uring_cqe *)((char *)r->cq_ring + p->cq_off.cqes);
+	return 0;
+
+uring_init_fail:
+	close(r->fd);
+	return -1;
+} // uring_init
+
+static void
+uring_exit(struct uring *r)
+{
+	munmap(r->sqes, r->sqes_sz);
+	if (r->cq_ring != r->sq_ring)
+		munmap(r->cq_ring, r->cq_sz);
+	munmap(r->sq_ring, r->sq_sz);
+	close(r->fd);
+} // uring_exit
+
+static void
+uring_queue_read(struct uring *r, char *buf, uint32_t len, off_t off, uint64_t data)
+{
+	uint32_t idx = r->sq_next++ & r->sq_mask;
+	struct io_uring_sqe *sqe = r->sqes + idx;
+
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_READ;
+	sqe->fd = ctx->read_fd;
+	sqe->addr = (uintptr_t)buf;
+	sqe->len = len;
+	sqe->off = off;
+	sqe->user_data = data;
+
+	r->sq_array[idx] = idx;
+	r->to_submit++;
+} // uring_queue_read
+
+// Submits all queued reads, and waits for wait_nr completions
+static void
+uring_enter(struct uring *r, uint32_t wait_nr)
+{
+	int ret;
+
+	__atomic_store_n(r->sq_tail, r->sq_next, __ATOMIC_RELEASE);
+
+	do {
+		ret = syscall(__NR_io_uring_enter, r->fd, r->to_submit, wait_nr,
+			      wait_nr ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+	} while ((ret < 0) && (errno == EINTR));
+
+	if (ret < 0) {
+		perror("io_uring_enter");
+		exit(EXIT_FAILURE);
+	}
+	r->to_submit -= ret;
+} // uring_enter
+
+static int
+uring_reap(struct uring *r, uint64_t *data, int32_t *res)
+{
+	uint32_t head = *r->cq_head;
+
+	if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE))
+		return 0;
+
+	struct io_uring_cqe *cqe = r->cqes + (head & r->cq_mask);
+	*data = cqe->user_data;
+	*res = cqe->res;
+
+	__atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+	return 1;
+} // uring_reap
+
+// Each reader keeps URING_DEPTH chunk reads in flight.  As each completes
+// we find the words in it, and then re-use its buffer for the next chunk
+static void
+file_reader_uring(struct worker *work)
+{
+	uint32_t rn = work - ctx->workers;
+	off_t offs[URING_DEPTH], off;
+	struct uring r[1];
+	int inflight = 0;
+
+	if (uring_init(r, URING_DEPTH) < 0)
+		return file_reader_pread(work);
+
+	// Submit the initial batch of reads, one per buffer
+	for (int b = 0; b < URING_DEPTH; b++) {
+		if ((off = atomic_fetch_add(&ctx->file_pos, READ_CHUNK)) >= ctx->read_len)
+			break;
+		offs[b] = off;
+		uring_queue_read(r, ctx->rbufs[rn][b], READ_LEN, off, b);
+		inflight++;
+	}
+	uring_enter(r, 0);
+
+	while (inflight > 0) {
+		uint64_t b, t1 = write_metrics ? get_ns() : 0;
+		int32_t res;
+
+		while (!uring_reap(r, &b, &res))
+			uring_enter(r, 1);
+
+		uint64_t t2 = write_metrics ? get_ns() : 0;
+
+		// A short read that is not at the end of the file, or a kernel
+		// without IORING_OP_READ, just falls back to a pread()
+		char *buf = ctx->rbufs[rn][b];
+		ssize_t n = res;
+		if ((n < 0) || ((n < READ_LEN) && ((offs[b] + n) < ctx->read_len)))
+			n = pread_full(buf, READ_LEN, offs[b]);
+
+		find_words_in_buffer(buf, n, offs[b], rn);
+
+		if (write_metrics) {
+			work->io_ns += t2 - t1;
+			work->scan_ns += get_ns() - t2;
+			work->chunks++;
+		}
+
+		if ((off = atomic_fetch_add(&ctx->file_pos, READ_CHUNK)) < ctx->read_len) {
+			offs[b] = off;
+			uring_queue_read(r, buf, READ_LEN, off, b);
+			uring_enter(r, 0);
+		} else {
+			inflight--;
+		}
+	}
+
+	uring_exit(r);
+} // file_reader_uring
+
+#endif
+
+// ********************* STREAM READER ********************
+
+// A single producer reads the stream sequentially into STREAM_BUFS buffers
+// in turn, while the other readers find the words in the buffers that have
+// been filled.  Each buffer has STREAM_CARRY bytes of space ahead of its data
+// for the partial last line of the buffer before it to be carried over into
+
+// Reads len bytes, only returning less at the end of the stream
+static ssize_t
+read_full(char *buf, size_t len)
+{
+	ssize_t ret, n = 0;
+
+	while (n < len) {
+		ret = read(ctx->read_fd, buf + n, len - n);
+		if (ret == 0)
+			break;
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			perror("read");
+			exit(EXIT_FAILURE);
+		}
+		n += ret;
+	}
+	return n;
+} // read_full
+
+// If consume is set, there are no other readers to hand the filled
+// buffers to, so we find the words in each buffer ourselves
+static void
+stream_producer(struct worker *work, int consume)
+{
+	uint32_t rn = work - ctx->workers;
+	char *carry = NULL;
+	size_t clen = 0;
+
+	for (int seq = 0; ; seq++) {
+		struct stream_buf *sb = ctx->stream_bufs + (seq % STREAM_BUFS);
+		char *data = ctx->sbufs[seq % STREAM_BUFS] + STREAM_CARRY;
+
+		// Wait until the consumers are done with this buffer
+		wait_for(&sb->freed, seq - STREAM_BUFS + 1);
+
+		// Carry over the partial line from the previous buffer
+		char *s = data - clen;
+		memcpy(s, carry, clen);
+
+		uint64_t t1 = write_metrics ? get_ns() : 0;
+
+		ssize_t n = read_full(data, READ_CHUNK);
+
+		if (write_metrics)
+			work->io_ns += get_ns() - t1;
+
+		char *e = data + n;
+		int eof = (n < READ_CHUNK);
+
+		if (eof) {
+			// Terminate any last line that has no newline
+			*e = '\n';
+			carry = e;
+		} else {
+			// Only pass on complete lines, and carry the rest
+			for (carry = e; (carry > s) && (carry[-1] != '\n'); carry--);
+		}
+
+		sb->s = s;
+		sb->e = carry;
+		clen = e - carry;
+
+		// Lines longer than STREAM_CARRY can't hold a 5 letter word.
+		// Just carry the tail end of such a line over, and make sure
+		// it doesn't start part way into a run of letters, as that
+		// run would then look like a shorter word than it truly is
+		if (clen > STREAM_CARRY) {
+			char *c = e - STREAM_CARRY;
+			if ((c[-1] >= 'a') && (c[-1] <= 'z'))
+				while ((c < e) && (*c >= 'a') && (*c <= 'z'))
+					c++;
+			if (c == e)
+				c = e - STREAM_CARRY;
+			carry = c;
+			clen = e - c;
+		}
+
+		if (consume) {
+			uint64_t t2 = write_metrics ? get_ns() : 0;
+
+			find_words(sb->s, sb->e, rn);
+
+			if (write_metrics) {
+				work->scan_ns += get_ns() - t2;
+				work->chunks++;
+			}
+			handoff_store(&sb->freed, seq + 1);
+		}
+
+		// The end must be known by the time the last buffer is seen
+		if (eof)
+			atomic_store(&ctx->stream_end, seq + 1);
+		handoff_store(&ctx->stream_filled, seq + 1);
+		if (eof)
+			break;
+	}
+} // stream_producer
+
+static void
+stream_consumer(struct worker *work)
+{
+	uint32_t rn = work - ctx->workers;
+
+	for (;;) {
+		int seq = atomic_fetch_add(&ctx->stream_next, 1);
+
+		// Wait for the buffer to be filled, or the stream to end
+		for (int n; seq >= (n = ctx->stream_filled); ) {
+			int end = ctx->stream_end;
+
+			if (end && (seq >= end))
+				return;
+			wait_change(&ctx->stream_filled, n);
+		}
+
+		struct stream_buf *sb = ctx->stream_bufs + (seq % STREAM_BUFS);
+		uint64_t t = write_metrics ? get_ns() : 0;
+
+		find_words(sb->s, sb->e, rn);
+
+		if (write_metrics) {
+			work->scan_ns += get_ns() - t;
+			work->chunks++;
+		}
+		handoff_store(&sb->freed, seq + 1);
+	}
+} // stream_consumer
+
 //#define FILE_READER_TIMES
 
 void
 file_reader(struct worker *work)
 {
-	uint32_t rn = work - workers;
+	uint32_t rn = work - ctx->workers;
 #ifdef FILE_READER_TIMES
 	struct timespec t1[1], t2[1];
 	clock_gettime(CLOCK_MONOTONIC, t1);
 #endif
 
+	if (ctx->reader_backend == READER_STREAM) {
+		// The first reader produces, and consumes too if it is alone
+		if (rn == (ctx->num_readers > 1))
+			stream_producer(work, ctx->num_readers < 3);
+		else
+			stream_consumer(work);
+		goto file_reader_done;
+	}
+
+	if (ctx->reader_backend == READER_PREAD) {
+		file_reader_pread(work);
+		goto file_reader_done;
+	}
+
+#ifdef HAVE_IO_URING
+	if (ctx->reader_backend == READER_URING) {
+		file_reader_uring(work);
+		goto file_reader_done;
+	}
+#endif
+
 	// The e = s + (READ_CHUNK + 1) below is done because each reader
 	// (except the first) only starts at a newline.  If the reader
 	// starts at the very start of a 5 letter word, that means that it
@@ -430,7 +1707,7 @@ file_reader(struct worker *work)
 	// have been skipped by the reader ahead of it
 	do {
 		char *s = work->start;
-		s += atomic_fetch_add(&file_pos, READ_CHUNK);
+		s += atomic_fetch_add(&ctx->file_pos, READ_CHUNK);
 		char *e = s + (READ_CHUNK + 1);
 
 		if (s > work->end)
@@ -443,113 +1720,131 @@ file_reader(struct worker *work)
 		if (s > work->start)
 			while ((s < e) && (*s++ != '\n'));
 
+		uint64_t t = write_metrics ? get_ns() : 0;
+
 		find_words(s, e, rn);
+
+		if (write_metrics) {
+			work->scan_ns += get_ns() - t;
+			work->chunks++;
+		}
 	} while (1);
 
+file_reader_done:
 #ifdef FILE_READER_TIMES
 	clock_gettime(CLOCK_MONOTONIC, t2);
 	print_time_taken("Find Words", t1, t2);
 #endif
-	atomic_fetch_add(&readers_done, 1);
+	handoff_add(&ctx->readers_done, 1);
 } // file_reader
 
 //#define HASH_TABLE_TIMES
 
-uint64_t
-process_words()
+// Sums the readers' character frequency stats into the frequency table
+static void
+collate_frequencies()
 {
-	uint64_t spins = 0;
+	for (int rn = 0; rn < ctx->num_readers; rn++)
+		for (int c = 0; c < 26; c++)
+			ctx->frq[c].f += ctx->cfs[rn][c];
+} // collate_frequencies
 
+// The readers build the hash table and key set themselves, so
+// all that's left for us is to wait for them, and then collate
+void
+process_words()
+{
 #ifdef HASH_TABLE_TIMES
 	struct timespec t1[1], t2[1];
 	clock_gettime(CLOCK_MONOTONIC, t1);
 #endif
 
-	// We do hash_init() and frq_init() here after the reader threads
-	// start. This speeds up application load time as the OS needs to
-	// clear less memory on startup.  Also, by initialising here, we
-	// avoid blocking other work while initialisation occurs.
-
-	// Build hash table and final key set
-	hash_init();
-	for (uint32_t *k = keys, key, pos = 0; ;) {
-		if (pos >= num_words) {
-			if (readers_done < num_readers) {
-				spins++;
-				asm("nop");
-				continue;
-			}
-			if (pos >= num_words) {
-				nkeys = k - keys;
-				*k = 0;
-				break;
-			}
-		}
+	// We do frq_init() here after the reader threads start.  This
+	// speeds up application load time as the OS needs to clear less
+	// memory on startup, and it overlaps with the readers' work
+	frq_init();
 
-		while ((key = wordkeys[pos]) == 0) {
-			spins++;
-			asm("nop");
-		}
+	wait_for(&ctx->readers_done, ctx->num_readers);
 
-		*k = key;
-		k += hash_insert(key, pos++);
-	}
+	ctx->nkeys = ctx->num_keys;
+	ctx->keys[ctx->nkeys] = 0;
 
 #ifdef HASH_TABLE_TIMES
 	clock_gettime(CLOCK_MONOTONIC, t2);
-	print_time_taken("Hash Insert", t1, t2);
+	print_time_taken("Readers Wait", t1, t2);
 #endif
 
 	// All readers are done.  Collate character frequency stats
-	frq_init();
-	for (int rn = 0; rn < num_readers; rn++)
-		for (int c = 0; c < 26; c++)
-			frq[c].f += cfs[rn][c];
-
-	return spins;
+	collate_frequencies();
 } // process_words
 
 void
 start_solvers()
 {
-	go_solve = 1;
+	handoff_store(&ctx->go_solve, 1);
 } // start_solvers
 
 
+#ifndef NO_FREQ_SETUP
+// A worker's share of building the frequency sets
+static void
+setup_work()
+{
+	while (1) {
+		int set_num = atomic_fetch_add(&ctx->setup_set, 1);
+
+		if (set_num >= 26)
+			break;
+
+		set_tier_offsets(ctx->frq + set_num);
+	}
+} // setup_work
+#endif
+
+// A worker's share of loading the words and building the frequency sets.
+// Returns 0 if the load failed, and so there's nothing to be done
+static int
+load_work(struct worker *work)
+{
+	int worker_num = work - ctx->workers;
+
+	// Wait until told to start
+	wait_change(&ctx->workers_start, 0);
+
+	if (ctx->workers_start < 0)
+		return 0;
+
+	if (worker_num < ctx->num_readers)
+		file_reader(work);
+
+#ifndef NO_FREQ_SETUP
+	setup_work();
+#endif
+
+	// Help to build the perfect hash while waiting to solve
+	if (ctx->use_mph)
+		mph_build_parts();
+
+	return 1;
+} // load_work
+
 // We create a worker pool like this because on virtual systems, especially
 // on WSL, thread-creation is very expensive, so we only want to do it once
 void *
 work_pool(void *arg)
 {
 	struct worker *work = (struct worker *)arg;
-	int worker_num = work - workers;
 
 	if (pthread_detach(pthread_self()))
 		perror("pthread_detach");
 
-	// Wait until told to start
-	while (!workers_start)
-		asm("nop");
+	pin_thread(work - ctx->workers);
 
-	if (worker_num < num_readers)
-		file_reader(work);
+	if (!load_work(work))
+		return NULL;
 
-#ifndef NO_FREQ_SETUP
-	while (1) {
-		int set_num = atomic_fetch_add(&setup_set, 1);
-
-		if (set_num >= 26)
-			break;
-
-		set_tier_offsets(frq + set_num);
-	}
-#endif
-
-	// Not gonna lie.  This is ugly.  We're busy-waiting until we get
-	// told to start solving.  It shouldn't be for too long though...
-	// I tried many different methods but this was always the fastest
-	while (!go_solve)
-		asm("nop");
+	// Wait until told to start solving
+	wait_change(&ctx->go_solve, 0);
 
 	solve_work();
 	return NULL;
@@ -560,61 +1855,91 @@ spawn_readers(char *start, size_t len)
 {
 	char *end = start + len;
 
-	num_readers = (len / READ_CHUNK) + 1;
+	ctx->num_readers = (len / READ_CHUNK) + 1;
+
+	// A stream has no known length.  One reader fills buffers while
+	// the others find the words in those already filled
+	if (ctx->reader_backend == READER_STREAM)
+		ctx->num_readers = STREAM_BUFS;
 
-	if (num_readers > MAX_READERS)
-		num_readers = MAX_READERS;
-	if (num_readers > nthreads)
-		num_readers = nthreads;
-	if (num_readers < 1)
-		num_readers = 1;
+	if (ctx->num_readers > MAX_READERS)
+		ctx->num_readers = MAX_READERS;
+	if (ctx->num_readers > ctx->nthreads)
+		ctx->num_readers = ctx->nthreads;
+	if (ctx->num_readers < 1)
+		ctx->num_readers = 1;
 
-	for (int i = 0; i < num_readers; i++) {
-		workers[i].start = start;
-		workers[i].end = end;
+	for (int i = 0; i < ctx->num_readers; i++) {
+		ctx->workers[i].start = start;
+		ctx->workers[i].end = end;
 	}
 
-	// Need to zero out the word table so that the main thread can
-	// detect when a word key has been written by a reader thread
-	if (num_readers > 1)
-		memset(wordkeys, 0, sizeof(wordkeys));
+	// The readers insert straight into the hash table
+	hash_init();
 
 	// Start any waiting workers
-	workers_start = 1;
+	handoff_store(&ctx->workers_start, 1);
 
 	// Check if main thread must do reading
-	if (num_readers < 2)
-		file_reader(workers);
+	if (ctx->num_readers < 2)
+		file_reader(ctx->workers);
 	else
-		atomic_fetch_add(&readers_done, 1);
+		handoff_add(&ctx->readers_done, 1);
 
-	// The main thread processes the words as the reader threads find them
+	// The main thread waits for the reader threads to find the words
 	process_words();
 } // spawn_readers
 
-// File Reader.  We use mmap() for efficiency for both reading and processing
-void
+// File Reader.  By default we use mmap() for efficiency for both reading and
+// processing, but the pread and uring back-ends read the file into buffers.
+// A path of "-" reads from stdin.  That, along with pipes or anything else
+// that isn't a regular file, always gets read by the stream back-end.
+// Returns -1 if the file can't be read, having told any waiting workers
+int
 read_words(char *path)
 {
+	struct stat statbuf[1];
 	int fd;
 
-
-	if ((fd = open(path, O_RDONLY)) < 0) {
+	if (!strcmp(path, "-")) {
+		fd = STDIN_FILENO;
+	} else if ((fd = open(path, O_RDONLY)) < 0) {
 		perror("open");
-		exit(EXIT_FAILURE);
+		goto read_words_fail;
 	}
 
-	struct stat statbuf[1];
 	if (fstat(fd, statbuf) < 0) {
 		perror("fstat");
-		exit(EXIT_FAILURE);
+		close(fd);
+		goto read_words_fail;
 	}
 
 	size_t len = statbuf->st_size;
+
+	if (!S_ISREG(statbuf->st_mode))
+		ctx->reader_backend = READER_STREAM;
+
+#ifndef HAVE_IO_URING
+	if (ctx->reader_backend == READER_URING)
+		ctx->reader_backend = READER_PREAD;
+#endif
+
+	if (ctx->reader_backend != READER_MMAP) {
+		ctx->read_fd = fd;
+		ctx->read_len = len;
+
+		// Start file reader threads
+		spawn_readers(NULL, len);
+
+		close(fd);
+		return 0;
+	}
+
 	char *addr = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
 	if (addr == MAP_FAILED) {
 		perror("mmap");
-		exit(EXIT_FAILURE);
+		close(fd);
+		goto read_words_fail;
 	}
 
 	// Safe to close file now.  mapping remains until munmap() is called
@@ -625,17 +1950,283 @@ read_words(char *path)
 
 	// We don't explicitly call munmap() as this can be slowish on some systems
 	// Instead we'll just let the process terminate and it'll get unmapped then
+#ifdef SOLVER_LIBRARY
+	munmap(addr, len);
+#endif
+	return 0;
+
+read_words_fail:
+	// Let any waiting workers know that there's nothing to do
+	handoff_store(&ctx->workers_start, -1);
+	return -1;
 } // read_words
 
 
+// ********************* WORD CACHE ********************
+
+// The output of find_words() and process_words() only depends upon the word
+// file, so it can be saved to a cache file and re-used on later runs.  The
+// cache holds the keys, the hash table, the words that it points to, and the
+// per letter frequencies.  It is tied to the word file by its size, mtime and
+// a hash of the 4KB blocks at its start, middle and end.  Hashing all of the
+// word file would cost about as much as reading it in the first place
+
+#define CACHE_MAGIC	0x6568636163357835ULL	// "5x5cache"
+#define CACHE_VERSION	2
+#define CACHE_SAMPLE	4096
+
+struct cache_header {
+	uint64_t	magic;
+	uint32_t	version;
+	uint32_t	hashbits;
+	uint64_t	src_size;
+	int64_t		src_mtime_sec;
+	int64_t		src_mtime_nsec;
+	uint64_t	src_hash;
+	uint32_t	nkeys;
+	uint32_t	hash_collisions;
+	uint32_t	frequencies[26];
+	uint32_t	wordlen;
+	uint32_t	pad[5];
+};
+
+// Followed by keys[nkeys + 1], keymap[HASHSZ], posmap[HASHSZ] and then the
+// 8 byte word slots, one for each key, which posmap now densely points to
+#define CACHE_SIZE(n)	(sizeof(struct cache_header) +			\
+			 (((n) + 1) * sizeof(uint32_t)) +		\
+			 (2 * HASHSZ * sizeof(uint32_t)) + ((n) << 3))
+
+// FNV-1a hash of the sampled blocks of the word file
+static uint64_t
+cache_source_hash(int fd, off_t size)
+{
+	off_t offs[3] = { 0, (size / 2) & ~(CACHE_SAMPLE - 1), size - CACHE_SAMPLE };
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	char buf[CACHE_SAMPLE];
+
+	for (int i = 0; i < 3; i++) {
+		ssize_t n = pread(fd, buf, CACHE_SAMPLE, offs[i] < 0 ? 0 : offs[i]);
+
+		for (ssize_t j = 0; j < n; j++)
+			hash = (hash ^ (uint8_t)buf[j]) * 0x100000001b3ULL;
+	}
+	return hash;
+} // cache_source_hash
+
+static int
+cache_source_matches(struct cache_header *ch, char *path)
+{
+	struct stat statbuf[1];
+	int fd, ret;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+		return 0;
+
+	if ((fstat(fd, statbuf) < 0) || !S_ISREG(statbuf->st_mode)) {
+		close(fd);
+		return 0;
+	}
+
+	ret = (ch->src_size == statbuf->st_size) &&
+	      (ch->src_mtime_sec == statbuf->st_mtim.tv_sec) &&
+	      (ch->src_mtime_nsec == statbuf->st_mtim.tv_nsec) &&
+	      (ch->src_hash == cache_source_hash(fd, statbuf->st_size));
+
+	close(fd);
+	return ret;
+} // cache_source_matches
+
+// Loads the words for path from the cache file, if it is valid for it.
+// On success the reader phase is skipped completely, and setup can start
+int
+load_word_cache(char *cache_file, char *path)
+{
+	struct stat statbuf[1];
+	int fd;
+
+	if ((fd = open(cache_file, O_RDONLY)) < 0)
+		return 0;
+
+	if ((fstat(fd, statbuf) < 0) || (statbuf->st_size < sizeof(struct cache_header))) {
+		close(fd);
+		return 0;
+	}
+
+	char *addr = mmap(NULL, statbuf->st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED)
+		return 0;
+
+	struct cache_header *ch = (struct cache_header *)addr;
+	if ((ch->magic != CACHE_MAGIC) || (ch->version != CACHE_VERSION) ||
+	    (ch->hashbits != HASHBITS) || (ch->wordlen != WORD_LEN) ||
+	    (ch->nkeys >= MAX_WORDS) ||
+	    (statbuf->st_size != CACHE_SIZE(ch->nkeys)) ||
+	    !cache_source_matches(ch, path)) {
+		munmap(addr, statbuf->st_size);
+		return 0;
+	}
+
+	// Let the worker threads go straight on to the frequency set setup
+	ctx->num_readers = 0;
+	handoff_store(&ctx->workers_start, 1);
+
+	uint32_t *kp = (uint32_t *)(ch + 1);
+	ctx->nkeys = ch->nkeys;
+	memcpy(ctx->keys, kp, (ctx->nkeys + 1) * sizeof(*ctx->keys));
+	kp += ctx->nkeys + 1;
+	memcpy(ctx->keymap, kp, sizeof(ctx->keymap));
+	kp += HASHSZ;
+	memcpy(ctx->posmap, kp, sizeof(ctx->posmap));
+	kp += HASHSZ;
+	memcpy(ctx->words, kp, ctx->nkeys << 3);
+	ctx->hash_collisions = ch->hash_collisions;
+
+	frq_init();
+	for (int c = 0; c < 26; c++)
+		ctx->frq[c].f = ch->frequencies[c];
+
+	munmap(addr, statbuf->st_size);
+	ctx->cache_hit = 1;
+	return 1;
+} // load_word_cache
+
+// Writes out the cache for path.  This must be called before anything
+// that alters keys[] or the hash table.  The file is written to a temporary
+// name and renamed into place so that a reader never sees a partial cache.
+// The compacted words and their positions are only needed while writing,
+// so they're allocated rather than kept with the context
+void
+save_word_cache(char *cache_file, char *path)
+{
+	uint32_t	*cposmap;
+	char		*cwords;
+	struct cache_header ch[1];
+	struct stat statbuf[1];
+	char tmp[512];
+	int fd;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+		return;
+
+	if ((fstat(fd, statbuf) < 0) || !S_ISREG(statbuf->st_mode)) {
+		close(fd);
+		return;
+	}
+
+	memset(ch, 0, sizeof(ch));
+	ch->magic = CACHE_MAGIC;
+	ch->version = CACHE_VERSION;
+	ch->hashbits = HASHBITS;
+	ch->wordlen = WORD_LEN;
+	ch->src_size = statbuf->st_size;
+	ch->src_mtime_sec = statbuf->st_mtim.tv_sec;
+	ch->src_mtime_nsec = statbuf->st_mtim.tv_nsec;
+	ch->src_hash = cache_source_hash(fd, statbuf->st_size);
+	ch->nkeys = ctx->nkeys;
+	ch->hash_collisions = ctx->hash_collisions;
+	close(fd);
+
+	for (int rn = 0; rn < MAX_READERS; rn++)
+		for (int c = 0; c < 26; c++)
+			ch->frequencies[c] += ctx->cfs[rn][c];
+
+	if ((cposmap = calloc(HASHSZ, sizeof(*cposmap))) == NULL)
+		return;
+	if ((cwords = malloc(MAX_WORDS * 8)) == NULL) {
+		free(cposmap);
+		return;
+	}
+
+	// Compact the words down to just the one used for each key
+	for (uint32_t h = 0, n = 0; h < HASHSZ; h++) {
+		if (ctx->keymap[h] == 0)
+			continue;
+		*(uint64_t *)(cwords + (n << 3)) = *(uint64_t *)(ctx->words + ctx->posmap[h]);
+		cposmap[h] = n++ << 3;
+	}
+
+	snprintf(tmp, sizeof(tmp), "%s.%d", cache_file, getpid());
+	if ((fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+		fprintf(stderr, "Unable to open %s for writing\n", tmp);
+		goto save_word_cache_done;
+	}
+
+	struct iovec iov[5] = {
+		{ ch, sizeof(ch) },
+		{ ctx->keys, (ctx->nkeys + 1) * sizeof(*ctx->keys) },
+		{ ctx->keymap, sizeof(ctx->keymap) },
+		{ cposmap, HASHSZ * sizeof(*cposmap) },
+		{ cwords, ctx->nkeys << 3 },
+	};
+
+	if ((writev(fd, iov, 5) != CACHE_SIZE(ctx->nkeys)) || (close(fd) < 0) ||
+	    (rename(tmp, cache_file) < 0)) {
+		fprintf(stderr, "Unable to write word cache %s\n", cache_file);
+		unlink(tmp);
+	}
+
+save_word_cache_done:
+	free(cwords);
+	free(cposmap);
+} // save_word_cache
+
+
 // ********************* RESULTS WRITER ********************
 
+// Lays out the words of a solution as a 32 byte line of tab separated
+// words, padded with spaces up to the terminating newline
+static inline void
+format_solution(char *so, const char **wp)
+{
+	char *se = so + SOLUTION_LEN - 1;
+
+	for (int i = 0; i < (NUM_WORDS - 1); i++) {
+		*(uint64_t *)so = *(uint64_t *)*wp++;
+		so[WORD_LEN] = '\t'; so += WORD_LEN + 1;
+	}
+
+	// The last word may not have room for a full 8 byte copy
+	memcpy(so, *wp, WORD_LEN);
+	for (so += WORD_LEN; so < se; *so++ = ' ');
+	*so = '\n';
+} // format_solution
+
+// Makes sure that the solutions are all laid out as lines of text, and
+// returns how many of them there are
+static ssize_t
+format_solutions()
+{
+	ssize_t len = ctx->num_sol - ctx->num_dropped;
+
+	if (len > MAX_SOLUTIONS)
+		len = MAX_SOLUTIONS;
+
+#ifdef WORD_INDEX
+	for (ssize_t i = 0; i < len; i++) {
+		const char *wp[NUM_WORDS];
+
+		for (int j = 0; j < NUM_WORDS; j++)
+			wp[j] = ctx->words + (ctx->solidx[i][j] << 3);
+		format_solution(ctx->solutions + (i << SOLUTION_SHIFT), wp);
+	}
+#endif
+	return len;
+} // format_solutions
+
 // Solutions exists as a single character array assembled
 // by the solver threads We just need to write it out.
 void
 emit_solutions()
 {
-	ssize_t len = num_sol << 5, written = 0;
+	ssize_t len = format_solutions(), written = 0;
+
+	// Other word shapes can find more solutions than we have room for
+	if (len < ctx->num_sol)
+		fprintf(stderr, "WARNING: Only writing the first %ld of %d solutions\n",
+			len, ctx->num_sol);
+
+	len <<= SOLUTION_SHIFT;
 
 	int solution_fd;
 	if ((solution_fd = open(solution_filename, O_WRONLY | O_CREAT, 0644)) < 0) {
@@ -658,7 +2249,7 @@ emit_solutions()
 
 	// We loop here to handle any short writes that might occur
 	while (written < len) {
-		ssize_t ret = write(solution_fd, solutions + written, len - written);
+		ssize_t ret = write(solution_fd, ctx->solutions + written, len - written);
 		if (ret < 0) {
 			fprintf(stderr, "Error writing to %s\n", solution_filename);
 			perror("write");
@@ -685,24 +2276,37 @@ by_frequency_hi(const void *a, const void *b)
 #endif
 
 
+// Both forms of GET_TIER index the same subset, as setup_tkeys() always
+// orders tm[] in the bit order that _pext_u32() packs them in.  The scalar
+// form tests all TIER_BITS of them, as those past tier_bits are 0
+#define TIER_BIT(n)	(!!(mask & f->tm[n]) << (n))
+#define TIER_INDEX_2	(TIER_BIT(0) + TIER_BIT(1))
+#define TIER_INDEX_3	(TIER_INDEX_2 + TIER_BIT(2))
+#define TIER_INDEX_4	(TIER_INDEX_3 + TIER_BIT(3))
+#define TIER_INDEX_5	(TIER_INDEX_4 + TIER_BIT(4))
+#define TIER_INDEX_6	(TIER_INDEX_5 + TIER_BIT(5))
+#define TIER_INDEX_7	(TIER_INDEX_6 + TIER_BIT(6))
+#define TIER_INDEX_N(n)	TIER_INDEX_ ## n
+#define TIER_INDEX(n)	TIER_INDEX_N(n)
+
+#define GET_TIER_PEXT struct tier *t = f->sets + _pext_u32(mask, f->tmm)
+#define GET_TIER_SCALAR struct tier *t = f->sets + TIER_INDEX(TIER_BITS)
+
 #ifdef _USE_PEXT_U32_
-#define GET_TIER struct tier *t = f->sets + _pext_u32(mask, f->tmm)
+#define GET_TIER GET_TIER_PEXT
 #else
-#define GET_TIER struct tier *t = f->sets + !!(mask & f->tm1) +	\
-				     (!!(mask & f->tm2) << 1) +	\
-				     (!!(mask & f->tm3) << 2) +	\
-				     (!!(mask & f->tm4) << 3)
+#define GET_TIER GET_TIER_SCALAR
 #endif
 
 // The sequence of instructions here is intended.  It achieves good concurrency
-// in the CPU by engaging both the ALU and AGU, which appears to be why f->tm5
-// tm6/tmm is faster than if using global variables or #defines
+// in the CPU by engaging both the ALU and AGU, which appears to be why f->tw1
+// tw2/tmm is faster than if using global variables or #defines
 
 #define CALCULATE_SET_AND_END					\
 	do {							\
 		GET_TIER;					\
-		uint32_t mf = !!(mask & f->tm5);		\
-		uint32_t ms = !(mask & f->tm6);			\
+		uint32_t mf = !!(mask & f->tw1);		\
+		uint32_t ms = !(mask & f->tw2);			\
 		uint32_t off = t->toff3 + (ms * t->tlen3);	\
 		uint32_t mx = !(ms | mf) * t->toff1;		\
 		end = t->s + off;				\
@@ -714,47 +2318,24 @@ setup_tkeys(struct frequency *f)
 {
 	struct tier	*t0 = f->sets;
 	uint32_t	*kp = t0->s + t0->l + NUM_POISON;
-	uint32_t	tm1 = f->tm1, tm2 = f->tm2;
-	uint32_t	tm3 = f->tm3, tm4 = f->tm4;
 	uint32_t	*ks, len;
-	uint32_t	masks[16];
+	uint32_t	masks[NUM_TIERS];
 
-#ifdef _USE_PEXT_U32_
-	do {
-		// We need to use the order that _pext_u32() will use
-		uint32_t tmm = f->tmm;
-		tm1 = 1 << __builtin_ctz(tmm);
-		tmm &= tmm - 1;
-		tm2 = 1 << __builtin_ctz(tmm);
-		tmm &= tmm - 1;
-		tm3 = 1 << __builtin_ctz(tmm);
-		tmm &= tmm - 1;
-		tm4 = 1 << __builtin_ctz(tmm);
-		tmm &= tmm - 1;
-	} while (0);
-#endif
+	// Order the tier masks by bit position, which is the order that
+	// _pext_u32() will use.  We write them back so that the scalar
+	// GET_TIER agrees with the pext one on which subset is which
+	uint32_t tmm = f->tmm;
+	for (int n = 0; n < TIER_BITS; n++, tmm &= tmm - 1)
+		f->tm[n] = tmm & -tmm;
 
-	// Define the mask bitmaps for splitting the sets
-	masks[0]  = 0;
-	masks[1]  = tm1;
-	masks[2]  = tm2;
-	masks[3]  = tm2 | tm1;
-	masks[4]  = tm3;
-	masks[5]  = tm3 | tm1;
-	masks[6]  = tm3 | tm2;
-	masks[7]  = tm3 | tm2 | tm1;
-
-	masks[8]  = tm4;
-	masks[9]  = tm4 | tm1;
-	masks[10] = tm4 | tm2;
-	masks[11] = tm4 | tm2 | tm1;
-	masks[12] = tm4 | tm3;
-	masks[13] = tm4 | tm3 | tm1;
-	masks[14] = tm4 | tm3 | tm2;
-	masks[15] = tm4 | tm3 | tm2 | tm1;
+	// Define the mask bitmaps for splitting the sets.  Subset i is
+	// those keys without any of the tier masks of the bits of i
+	masks[0] = 0;
+	for (uint32_t i = 1; i < (1 << ctx->tier_bits); i++)
+		masks[i] = masks[i & (i - 1)] | f->tm[__builtin_ctz(i)];
 
 	// Create key arrays for each tier set mask
-	for (uint32_t mask, i = 1; i < 16; i++) {
+	for (uint32_t mask, i = 1; i < (1 << ctx->tier_bits); i++) {
 		struct tier *ts = f->sets + i;
 		mask = masks[i];
 
@@ -762,23 +2343,31 @@ setup_tkeys(struct frequency *f)
 		ts->s = kp;
 
 		len = t0->toff1;
-		while (len--)
+		while (len--) {
+			copy_index(kp, ks);
 			kp += !((*kp = *ks++) & mask);
+		}
 		ts->toff1 = kp - ts->s;
 
 		len = t0->toff2 - t0->toff1;
-		while (len--)
+		while (len--) {
+			copy_index(kp, ks);
 			kp += !((*kp = *ks++) & mask);
+		}
 		ts->toff2 = kp - ts->s;
 
 		len = t0->toff3 - t0->toff2;
-		while (len--)
+		while (len--) {
+			copy_index(kp, ks);
 			kp += !((*kp = *ks++) & mask);
+		}
 		ts->toff3 = kp - ts->s;
 
 		len = t0->l - t0->toff3;
-		while (len--)
+		while (len--) {
+			copy_index(kp, ks);
 			kp += !((*kp = *ks++) & mask);
+		}
 		ts->l = kp - ts->s;
 		ts->tlen3 = ts->l - ts->toff3;
 
@@ -787,6 +2376,179 @@ setup_tkeys(struct frequency *f)
 	}
 } // setup_tkeys
 
+// The solvers pass over the keys of a set that have a tier letter which is
+// already in the mask, so the best tier letters are those that are both in
+// many of the set's keys and likely to be in the mask.  Each set before f,
+// which are those of the rarer letters, has had a word taken from it unless
+// its own letter was already in the mask, and we take that word to have each
+// letter as often as that set's keys do.  That gives the chance of a letter
+// being in the mask, and from that the expected scan length for any choice
+// of tier letters.  Letters are picked greedily, each being the one that
+// takes the most off the scan length left by those picked before it
+
+// No letter is ever certain to be in the mask, as it may have been skipped
+#define TIER_MAX_CHANCE	0.98f
+#define TIER_POOL	12		// Letters that the tier letters are picked from
+#define TIER_TOP	4		// Picked first from all the keys
+#define TIER_REST	4		// Picked last from the keys with none of those
+#define TIER_SHIFT	12		// Fixed point fraction bits of a key
+
+// "uaeios" were the static tier letters, which suit English best
+#define UAEIOS	((1 << ('u' - 'a')) | (1 << ('a' - 'a')) | (1 << ('e' - 'a')) |	\
+		 (1 << ('i' - 'a')) | (1 << ('o' - 'a')) | (1 << ('s' - 'a')))
+
+// Packs the bits of key that are in mask down into its low bits, in order
+static inline uint32_t
+pack_bits(uint32_t key, uint32_t mask)
+{
+#ifdef __BMI2__
+	return _pext_u32(key, mask);
+#else
+	uint32_t h = 0;
+
+	for (int n = 0; mask; mask &= mask - 1, n++)
+		h |= !!(key & mask & -mask) << n;
+	return h;
+#endif
+} // pack_bits
+
+// Returns the scan length expected over set t with the tier letters tmm,
+// where p[c] is the chance that letter c is in the mask
+static float
+tier_scan_length(struct tier *t, const float *p, uint32_t tmm)
+{
+	float len = 0;
+
+	for (uint32_t k = 0; k < t->l; k++) {
+		float w = 1.0f;
+
+		for (uint32_t bits = t->s[k] & tmm; bits; bits &= bits - 1)
+			w *= 1.0f - p[__builtin_ctz(bits)];
+		len += w;
+	}
+	return len;
+} // tier_scan_length
+
+static void
+choose_tier_letters(struct frequency *f)
+{
+	struct tier *t = f->sets;
+	uint32_t *cnt = ctx->set_letters[f - ctx->frq];
+	uint32_t tm[TIER_BITS + 2], pool[TIER_POOL], in_pool = f->m, picked = 0;
+	uint16_t hist[1 << TIER_POOL];
+	uint32_t pats[1 << TIER_POOL], w[1 << TIER_POOL], npats = 0;
+	float p[32], score[32], len = t->l;
+	int set_num = f - ctx->frq;
+
+	// The chance of each letter not being in the mask.  The earlier sets
+	// may still be getting counted
+	for (int c = 0; c < 32; c++)
+		p[c] = 1.0f;
+	for (struct frequency *e = ctx->frq; e < f; e++) {
+		wait_for(&e->ready, 2);
+
+		uint32_t *ecnt = ctx->set_letters[e - ctx->frq];
+		if (e->sets->l == 0)
+			continue;
+
+		float draw = p[e->b] / e->sets->l;
+		for (int c = 0; c < 26; c++)
+			p[c] *= 1.0f - (draw * ecnt[c]);
+	}
+	for (int c = 0; c < 32; c++) {
+		p[c] = 1.0f - p[c];
+		if (p[c] > TIER_MAX_CHANCE)
+			p[c] = TIER_MAX_CHANCE;
+	}
+	p[f->b] = 0;	// Never in the mask when this set is scanned
+
+	// Only the letters with the most to give are picked from, so that the
+	// keys can be counted by which of those letters they have.  Half are
+	// those that the most keys would be passed over for.  The rest are the
+	// same for the keys that have none of those, as after the first few
+	// letters are picked, it's the keys without them that are left
+	uint32_t rest[32] = { 0 }, top = 0;
+
+	for (int c = 0; c < 32; c++)
+		score[c] = (in_pool & (1 << c)) ? -1.0f : cnt[c] * p[c];
+	for (int n = 0; n < TIER_POOL; n++) {
+		int best = 0;
+
+		if (n == TIER_TOP)
+			top = in_pool & ~f->m;
+		if (n == (TIER_POOL - TIER_REST)) {
+			for (uint32_t k = 0; k < t->l; k++)
+				if (!(t->s[k] & top))
+					for (uint32_t bits = t->s[k]; bits; bits &= bits - 1)
+						rest[__builtin_ctz(bits)]++;
+			for (int c = 0; c < 32; c++)
+				score[c] = (in_pool & (1 << c)) ? -1.0f : rest[c] * p[c];
+		}
+
+		for (int c = 1; c < 26; c++)
+			if (score[c] > score[best])
+				best = c;
+		score[best] = -1.0f;
+		in_pool |= 1 << best;
+	}
+	in_pool &= ~f->m;
+	for (uint32_t n = 0, bits = in_pool; bits; bits &= bits - 1)
+		pool[n++] = __builtin_ctz(bits);
+
+	memset(hist, 0, sizeof(hist));
+	for (uint32_t k = 0; k < t->l; k++) {
+		uint32_t h = pack_bits(t->s[k], in_pool);
+
+		if (hist[h]++ == 0)
+			pats[npats++] = h;
+	}
+
+	// w[i] is how many keys with the pool letters pats[i] are still
+	// expected to be scanned.  It's fixed point so that the sums vectorise
+	for (uint32_t i = 0; i < npats; i++)
+		w[i] = hist[pats[i]] << TIER_SHIFT;
+
+	for (int n = 0; n < (ctx->tier_bits + 2); n++) {
+		float gain[TIER_POOL];
+		int best = -1;
+
+		for (int j = 0; j < TIER_POOL; j++) {
+			uint32_t g = 0;
+
+			if (picked & (1 << j))
+				continue;
+			for (uint32_t i = 0; i < npats; i++)
+				g += w[i] & -((pats[i] >> j) & 1);
+			gain[j] = g * p[pool[j]];
+			if ((best < 0) || (gain[j] > gain[best]))
+				best = j;
+		}
+
+		uint32_t miss = (1.0f - p[pool[best]]) * (1 << TIER_SHIFT);
+
+		tm[n] = 1 << pool[best];
+		picked |= 1 << best;
+		for (uint32_t i = 0; i < npats; i++) {
+			uint32_t has = -((pats[i] >> best) & 1);
+
+			w[i] = (w[i] & ~has) | ((((uint64_t)w[i] * miss) >> TIER_SHIFT) & has);
+		}
+	}
+
+	for (uint32_t i = 0; i < npats; i++)
+		len -= hist[pats[i]] - ((float)w[i] / (1 << TIER_SHIFT));
+
+	// The first picks split the set, as they're the most often in the mask
+	f->tmm = 0;
+	for (int n = 0; n < ctx->tier_bits; n++)
+		f->tmm |= tm[n];
+	f->tw1 = tm[ctx->tier_bits];
+	f->tw2 = tm[ctx->tier_bits + 1];
+	ctx->tier_scan[set_num] = len;
+	if (write_metrics)
+		ctx->uaeios_scan[set_num] = tier_scan_length(t, p, UAEIOS);
+} // choose_tier_letters
+
 // This function looks like it's doing a lot, but because of good spatial
 // and temportal localities each call typically takes ~1us on words_alpha
 static void
@@ -796,8 +2558,7 @@ set_tier_offsets(struct frequency *f)
 	uint32_t *ks, *kp;
 
 	// Wait here until all data is ready
-	while (!f->ready)
-		asm("nop");
+	wait_change(&f->ready, 0);
 
 	// "poison" NUM_POISON ending values with all bits set
 	struct tier *t = f->sets;
@@ -805,56 +2566,61 @@ set_tier_offsets(struct frequency *f)
 	for (int p = NUM_POISON; p--; )
 		*ks++ = (uint32_t)(~0);
 
+	// Count the letters of our keys, for the later sets to choose their
+	// tier letters with
+	uint32_t *cnt = ctx->set_letters[f - ctx->frq];
+	memset(cnt, 0, sizeof(ctx->set_letters[0]));
+	for (ks = t->s, len = t->l; len--; )
+		for (key = *ks++; key; key &= key - 1)
+			cnt[__builtin_ctz(key)]++;
+	handoff_store(&f->ready, 2);
+
 	// Skip first set.  Nothing uses its subsets
-	if (f == frq)
+	if (f == ctx->frq)
 		goto set_tier_offsets_done;
 
-	// "uaeios" are the best static defaults
-	f->tm1 = 1 << ('u' - 'a');
-	f->tm2 = 1 << ('a' - 'a');
-	f->tm3 = 1 << ('e' - 'a');
-	f->tm4 = 1 << ('i' - 'a');
-	f->tm5 = 1 << ('o' - 'a');
-	f->tm6 = 1 << ('s' - 'a');
-	f->tmm = (f->tm1 | f->tm2 | f->tm3 | f->tm4);
+	choose_tier_letters(f);
 
 	// Organise full set into 2 subsets, that which
-	// has tm5 followed by that which does not
+	// has tw1 followed by that which does not
 
-	mask = f->tm5;
+	mask = f->tw1;
 
-	// First subset has tm5, and then not
+	// First subset has tw1, and then not
 	ks = kp = t->s;
 	len = t->l;
 	for (; len--; ++ks)
 		if ((key = *ks) & mask) {
+			swap_index(ks, kp);
 			*ks = *kp;
 			*kp++ = key;
 		}
 	t->toff2 = kp - t->s;
 
-	// Now organise the first tm5 subset into that which
-	// has tm6 followed by that which does not, and then
-	// the second tm5 subset into that which does not
-	// have tm6 followed by that which does
+	// Now organise the first tw1 subset into that which
+	// has tw2 followed by that which does not, and then
+	// the second tw1 subset into that which does not
+	// have tw2 followed by that which does
 
-	mask = f->tm6;
+	mask = f->tw2;
 
-	// First tm1 subset has tm2 then not
+	// First tw1 subset has tw2 then not
 	ks = kp = t->s;
 	len = t->toff2;
 	for (; len--; ++ks)
 		if ((key = *ks) & mask) {
+			swap_index(ks, kp);
 			*ks = *kp;
 			*kp++ = key;
 		}
 	t->toff1 = kp - t->s;
 
-	// Second tm5 subset does not have tm6 then has
+	// Second tw1 subset does not have tw2 then has
 	ks = kp = t->s + t->toff2;
 	len = t->l - t->toff2;
 	for (; len--; ++ks)
 		if (!((key = *ks) & mask)) {
+			swap_index(ks, kp);
 			*ks = *kp;
 			*kp++ = key;
 		}
@@ -865,7 +2631,7 @@ set_tier_offsets(struct frequency *f)
 
 set_tier_offsets_done:
 	// Mark as done
-	atomic_fetch_add(&setups_done, 1);
+	handoff_add(&ctx->setups_done, 1);
 } // set_tier_offsets
 
 // Specialised frequency sort, since we only need to swap the first 8 bytes
@@ -876,23 +2642,38 @@ fsort()
 {
 	for (int i = 1; i < 26; ++i)
 		for (int j = i; j; --j) {
-			if (frq[j].f == 0)
+			if (ctx->frq[j].f == 0)
 				break;
-			if (frq[j - 1].f && (frq[j].f > frq[j - 1].f))
+			if (ctx->frq[j - 1].f && (ctx->frq[j].f > ctx->frq[j - 1].f))
 				break;
 			// Swap first 8 bytes
-			uint64_t tmp = *(uint64_t *)(frq + j);
-			*(uint64_t *)(frq + j) = *(uint64_t *)(frq + (j - 1));
-			*(uint64_t *)(frq + (j - 1)) = tmp;
+			uint64_t tmp = *(uint64_t *)(ctx->frq + j);
+			*(uint64_t *)(ctx->frq + j) = *(uint64_t *)(ctx->frq + (j - 1));
+			*(uint64_t *)(ctx->frq + (j - 1)) = tmp;
 		}
 
 	// Set the bit indices and the unmap table
 	for (int i = 0, one = 1; i < 26; i++) {
-		frq[i].b = __builtin_ctz(frq[i].m);
-		unmap[frq[i].b] = (one << i);
+		ctx->frq[i].b = __builtin_ctz(ctx->frq[i].m);
+		ctx->unmap[ctx->frq[i].b] = (one << i);
 	}
 } // fsort
 
+// Returns which frequency set key belongs in, which is that of its least
+// frequent letter
+static inline uint32_t
+key_set(uint32_t key)
+{
+	uint32_t mk = ctx->unmap[__builtin_ctz(key)];
+	uint32_t k = key & (key - 1);
+
+	for (int i = 1; i < WORD_LEN; i++) {
+		mk |= ctx->unmap[__builtin_ctz(k)];
+		k &= k - 1;
+	}
+	return __builtin_ctz(mk);
+} // key_set
+
 // The role of this function is to re-arrange the key set according to all
 // words containing the least frequently used letter, and then scanning the
 // remainder and so on until all keys have been assigned to sets. It achieves
@@ -904,61 +2685,533 @@ fsort()
 void
 setup_frequency_sets()
 {
+	// Excluded letters get skipped in every solution.  Sorting them first
+	// has the solvers use their skips up on them straight away
+	for (int c = 0; c < 26; c++)
+		if (ctx->excluded & (1 << c))
+			ctx->frq[c].f = -1;
+	ctx->sets_excluded = ctx->excluded;
+
+	// Any replicas are of the sets from before
+	for (int n = 0; n < MAX_NODES; n++)
+		ctx->replica_state[n].state = REPLICA_STALE;
+
 	fsort();
 
-	// Setup for key spray
+	// Count the keys of each set.  Words with an excluded letter can't be
+	// in any solution, and go in the 27th which is never used
+	uint8_t kset[MAX_WORDS + 1024];
+	uint32_t count[27] = { 0 }, n = 0;
+	for (uint32_t *kp = ctx->keys, key; (key = *kp++); n++)
+		count[kset[n] = (key & ctx->excluded) ? 26 : key_set(key)]++;
+
+	// Setup for key spray.  Each set has room for the keys and poison of
+	// all of its tier subsets, however the keys fall into them, and starts
+	// on a cache line
 	uint32_t *bp[32] __attribute__((aligned(64)));
-	for (uint32_t i = 0; i < 26; i++)
-		bp[i] = tkeys[i];
+	bp[0] = ctx->tkeys;
+	for (uint32_t i = 1; i < 26; i++)
+		bp[i] = bp[i - 1] + ((((count[i - 1] + NUM_POISON) << ctx->tier_bits) + 15) & ~15);
 
 	// Spray keys to buckets
-	for (uint32_t *kp = keys, key; (key = *kp++); ) {
-		uint32_t mk = unmap[__builtin_ctz(key)];
-		uint32_t k = key & (key - 1);
-
-		mk |= unmap[__builtin_ctz(k)]; k &= k - 1;
-		mk |= unmap[__builtin_ctz(k)]; k &= k - 1;
-		mk |= unmap[__builtin_ctz(k)]; k &= k - 1;
-		mk |= unmap[__builtin_ctz(k)];
+	n = 0;
+	for (uint32_t *kp = ctx->keys, key; (key = *kp++); n++) {
+		if (kset[n] == 26)
+			continue;
 
-		*bp[__builtin_ctz(mk)]++ = key;
+		uint32_t *dp = bp[kset[n]]++;
+		*dp = key;
+#ifdef WORD_INDEX
+		// One hash lookup per key here, so the solvers need none
+		key_index(dp) = (hash_lookup(key) - ctx->words) >> 3;
+#endif
 	}
 
 	// Start worker threads
 	for (int i = 0; i < 26; i++) {
-		struct frequency *f = frq + i;
+		struct frequency *f = ctx->frq + i;
 		struct tier *t = f->sets;
 
-		t->s = tkeys[i];
-		t->l = bp[i] - t->s;
+		t->l = count[i];
+		t->s = bp[i] - t->l;
 
 		// Instruct any waiting worker thread to start setup
 		// but we have to do it ourselves if single threaded
-		f->ready = 1;
-		if (nthreads == 1)
+		handoff_store(&f->ready, 1);
+		if (ctx->nthreads == 1)
 			set_tier_offsets(f);
 	}
 
 	// Wait for all setups to complete
-	while(setups_done < 26)
-		asm("nop");
+	wait_for(&ctx->setups_done, 26);
 } // setup_frequency_sets
 
+#ifndef NO_FREQ_SETUP
+
+// ********************* CONSTRAINTS ********************
+
+// A solve may be constrained to the solutions that have certain words, that
+// use certain letters, or that don't use certain letters.  Excluded letters
+// are pruned when the frequency sets are built, so no key with one gets
+// looked at.  The seed words start every solution, with their letters in
+// the starting mask, and the solvers only search for what's left after them.
+// Required letters may not be skipped.  See solve_work() in kernels.h
+
+// Adds the letters in s to *mask.  Returns -1 if s has anything but a to z
+static int
+add_letters(uint32_t *mask, const char *s)
+{
+	for (; *s; s++) {
+		if ((*s < 'a') || (*s > 'z'))
+			return -1;
+		*mask |= 1 << (*s - 'a');
+	}
+	return 0;
+} // add_letters
+
+// Adds a word that every solution must have.  Returns -1 if it isn't a
+// WORD_LEN letter word with no repeated letters, or if there are too many
+static int
+add_seed_word(const char *w)
+{
+	if ((strlen(w) != WORD_LEN) || (ctx->nseeds == NUM_WORDS))
+		return -1;
+
+	uint32_t key = 0;
+	if (add_letters(&key, w) || (__builtin_popcount(key) != WORD_LEN))
+		return -1;
+
+	ctx->seed_keys[ctx->nseeds++] = key;
+	return 0;
+} // add_seed_word
+
+// Finds the seed words in the frequency sets, for their key refs.  Must be
+// called after setup_frequency_sets().  Returns -1 if a seed word isn't in
+// the word list
+static int
+setup_constraints()
+{
+	ctx->seed_mask = 0;
+	ctx->unsolvable = 0;
+
+	for (int i = 0; i < ctx->nseeds; i++) {
+		uint32_t key = ctx->seed_keys[i];
+
+		// Seed words that use an excluded letter, or that share a
+		// letter, leave nothing to find
+		if ((key & ctx->excluded) || (key & ctx->seed_mask))
+			ctx->unsolvable = 1;
+		ctx->seed_mask |= key;
+
+		// Words with excluded letters aren't in the sets to be found
+		if (key & ctx->excluded)
+			continue;
+
+		struct frequency *f = ctx->frq + key_set(key);
+		uint32_t *kp = f->sets->s, *end = kp + f->sets->l;
+
+		while ((kp < end) && (*kp != key))
+			kp++;
+		if (kp == end)
+			return -1;
+		ctx->seeds[i] = key_ref(f, kp);
+	}
+	return 0;
+} // setup_constraints
+
+// ********************* NUMA ********************
+
+// On a machine with more than one memory node, the solvers on each node
+// read the frequency sets from their own replica of them, rather than all
+// from wherever the pages first got touched.  The first solver on a node
+// copies them at the start of the solve, so that the copy lands on that
+// node.  Each node also counts its own solutions, and claims lines of the
+// solutions array for them a chunk at a time, so the nodes rarely share a
+// cache line there either
+
+// Counts the memory nodes from sysfs
+static void
+numa_init()
+{
+	char buf[256];
+	int fd, len, max = 0;
+
+	ctx->num_nodes = 1;
+	if ((fd = open("/sys/devices/system/node/online", O_RDONLY)) >= 0) {
+		if ((len = read(fd, buf, sizeof(buf) - 1)) > 0) {
+			// A list of ranges, such as 0-1 or 0,2-3
+			buf[len] = '\0';
+			for (char *p = buf; *p; ) {
+				int n = strtol(p, &p, 10);
+				if (n > max)
+					max = n;
+				if (*p)
+					p++;
+			}
+			ctx->num_nodes = max + 1;
+		}
+		close(fd);
+	}
+
+	if (ctx->force_nodes)
+		ctx->num_nodes = ctx->force_nodes;
+	if (ctx->num_nodes > MAX_NODES)
+		ctx->num_nodes = MAX_NODES;
+} // numa_init
+
+// Returns which node solver sn is on
+static int
+solver_node(int sn)
+{
+	unsigned int cpu, node;
+
+	if (ctx->num_nodes < 2)
+		return 0;
+	if (ctx->force_nodes)
+		return sn % ctx->num_nodes;
+	if (syscall(SYS_getcpu, &cpu, &node, NULL) < 0)
+		return 0;
+	return node % ctx->num_nodes;
+} // solver_node
+
+// Returns the frequency sets for the solvers on node to use, copying
+// them into its replica first if no solver on the node has yet
+static struct frequency *
+get_replica(int node)
+{
+	if (node == 0)
+		return ctx->frq;
+
+	struct replica *r = ctx->replicas + (node - 1);
+	atomic_int *state = &ctx->replica_state[node].state;
+	int stale = REPLICA_STALE;
+
+	if (!atomic_compare_exchange_strong(state, &stale, REPLICA_COPYING)) {
+		wait_for(state, REPLICA_READY);
+		return r->frq;
+	}
+
+	for (int i = 0; i < 26; i++) {
+		uint32_t *from = ctx->tiers[i]->s, *to = from;
+
+		for (int j = 0; j < NUM_TIERS; j++) {
+			struct tier *t = ctx->tiers[i] + j;
+
+			r->tiers[i][j] = *t;
+			if (t->s == NULL)
+				continue;
+			r->tiers[i][j].s = r->tkeys + (t->s - ctx->tkeys);
+			if (t->s + t->l + NUM_POISON > to)
+				to = t->s + t->l + NUM_POISON;
+		}
+		memcpy(r->tkeys + (from - ctx->tkeys), from, (to - from) * sizeof(*from));
+
+		r->frq[i] = ctx->frq[i];
+		r->frq[i].sets = r->tiers[i];
+		r->frq[i].tkeys = r->tkeys;
+		r->frq[i].node = node;
+	}
+
+	handoff_store(state, REPLICA_READY);
+	return r->frq;
+} // get_replica
+
+// Moves the solutions that each node kept together at the start of the
+// solutions array.  Called by the last solver to finish.  The chunks were
+// handed out in line order, and only the last chunk of each node can be part
+// full, so each chunk just moves down to follow the lines kept before it
+static void
+gather_solutions()
+{
+	int part[MAX_NODES], fill[MAX_NODES], nparts = 0;
+	int lines = atomic_load(&ctx->sol_next), kept = 0, found = 0;
+
+	if (lines > MAX_SOLUTIONS)
+		lines = MAX_SOLUTIONS;
+
+	for (int node = 0; node < ctx->num_nodes; node++) {
+		int n = ctx->node_sol[node].n, c = (n - 1) / SOL_CHUNK;
+
+		found += n;
+		if ((n > 0) && (c < SOL_CHUNKS)) {
+			part[nparts] = ctx->node_sol[node].chunk[c] - 1;
+			fill[nparts++] = n - (c * SOL_CHUNK);
+		}
+	}
+
+	for (int base = 0; base < lines; base += SOL_CHUNK) {
+		int keep = SOL_CHUNK;
+
+		for (int i = 0; i < nparts; i++)
+			if (part[i] == base)
+				keep = fill[i];
+		if (keep > lines - base)
+			keep = lines - base;
+
+		if (kept != base) {
+#ifdef WORD_INDEX
+			memmove(ctx->solidx[kept], ctx->solidx[base],
+				keep * sizeof(*ctx->solidx));
+#else
+			memmove(ctx->solutions + (kept << SOLUTION_SHIFT),
+				ctx->solutions + (base << SOLUTION_SHIFT),
+				keep << SOLUTION_SHIFT);
+#endif
+		}
+		kept += keep;
+	}
+
+	ctx->num_sol = found;
+	ctx->num_dropped = found - kept;
+} // gather_solutions
+
+#endif
+
+// ********************* SOLVER ENGINES ********************
+
+// The depth first finders are the default.  The breadth first engine
+// expands a task's search one level at a time instead, the bitmap engine
+// narrows the keys down with bitmaps of which are compatible, and the meet
+// in the middle engine finds the last two words with a hash join.  See
+// kernels.h
+#define ENGINE_DFS	0
+#define ENGINE_BFS	1
+#define ENGINE_BITMAP	2
+#define ENGINE_MITM	3
+
+// ********************* SETTINGS ********************
+
+// Every context starts out with the default settings, which the executables
+// then change from the command line.  The nodes are counted by numa_init()
+static void
+settings_init()
+{
+	ctx->tier_bits = TIER_BITS;
+	ctx->spin_budget = SPIN_BUDGET;
+	ctx->solver_engine = ENGINE_DFS;
+	ctx->num_nodes = 1;
+	ctx->force_nodes = 0;
+} // settings_init
+
+#ifdef RUNTIME_DISPATCH
+
+// ********************* RUNTIME KERNEL DISPATCH ********************
+
+static const char *kernel_names[] = { "scalar", "avx2", "avx512" };
+static int kernel_isa = -1;	// -1 means pick the best available
+
+// Binds the solver kernels for the given instruction set
+static void bind_kernels(int isa);
+
+// Use cpuid to find the best kernel set that this CPU can run.  The AVX
+// kernels also rely on pext, so require BMI2 alongside them
+static int
+best_kernel_isa()
+{
+	__builtin_cpu_init();
+
+	if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("bmi2"))
+		return KERNEL_SCALAR;
+
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		return KERNEL_AVX512;
+
+	return KERNEL_AVX2;
+} // best_kernel_isa
+
+// Must be called before any reader or solver threads are started
+static void
+select_kernels()
+{
+	int best = best_kernel_isa();
+
+	// A kernel requested with -k is honoured if the CPU can run it
+	if (kernel_isa > best)
+		fprintf(stderr, "%s kernels not supported on this system, using %s\n",
+			kernel_names[kernel_isa], kernel_names[best]);
+	if ((kernel_isa < 0) || (kernel_isa > best))
+		kernel_isa = best;
+
+	if (kernel_isa == KERNEL_AVX512)
+		find_fives = find_fives_avx512;
+	else if (kernel_isa == KERNEL_AVX2)
+		find_fives = find_fives_avx2;
+	else
+		find_fives = NULL;
+
+	bind_kernels(kernel_isa);
+} // select_kernels
+
+#ifndef DONT_INCLUDE_MAIN
+// Convert a -k argument to a kernel instruction set
+static int
+parse_kernel_isa(const char *name)
+{
+	for (int isa = KERNEL_SCALAR; isa <= KERNEL_AVX512; isa++)
+		if (!strcmp(name, kernel_names[isa]))
+			return isa;
+	return -1;
+} // parse_kernel_isa
+#endif
+
+#endif
+
 #ifndef DONT_INCLUDE_MAIN
 
 // ********************* MAIN SETUP AND OUTPUT ********************
 
+static const char *reader_names[] = { "mmap", "pread", "uring", "stream" };
+
+// Convert a -r argument to a file reader back-end
+static int
+parse_reader_backend(const char *name)
+{
+	for (int rb = READER_MMAP; rb <= READER_STREAM; rb++)
+		if (!strcmp(name, reader_names[rb]))
+			return rb;
+	return -1;
+} // parse_reader_backend
+
+static const char *engine_names[] = { "dfs", "bfs", "bitmap", "mitm" };
+
+// Convert a -e argument to a solver engine
+static int
+parse_solver_engine(const char *name)
+{
+	for (int e = ENGINE_DFS; e <= ENGINE_MITM; e++)
+		if (!strcmp(name, engine_names[e]))
+			return e;
+	return -1;
+} // parse_solver_engine
+
+// The compares are estimated from the scan lengths expected, as the solvers
+// don't count them.  Both are printed, rather than the percentage saved, as
+// the letters chosen are sometimes no better than uaeios, or even worse
+static void
+print_tier_metrics()
+{
+	float chosen = 0, uaeios = 0;
+
+	for (int i = 1; i < 26; i++) {
+		chosen += ctx->tier_scan[i];
+		uaeios += ctx->uaeios_scan[i];
+	}
+	printf("Tier Compares     = %8.0f (est.)\n", chosen);
+	printf("Uaeios Compares   = %8.0f (est.)\n", uaeios);
+} // print_tier_metrics
+
+// Per chunk costs of the file reader back-end.  For mmap() the page-fault
+// costs show up in the scan time, as the faults happen within find_words()
+static void
+print_reader_metrics()
+{
+	uint64_t io_ns = 0, scan_ns = 0, chunks = 0;
+
+	for (int i = 0; i < ctx->num_readers; i++) {
+		io_ns += ctx->workers[i].io_ns;
+		scan_ns += ctx->workers[i].scan_ns;
+		chunks += ctx->workers[i].chunks;
+	}
+
+	if (chunks == 0)
+		return;
+
+	printf("Reader Back-end   = %8s\n", reader_names[ctx->reader_backend]);
+	printf("Chunks Read       = %8lu\n", chunks);
+	printf("Chunk Read Wait   = %8lu ns/chunk\n", io_ns / chunks);
+	printf("Chunk Scan        = %8lu ns/chunk\n", scan_ns / chunks);
+} // print_reader_metrics
+
+// How long each solver spent solving, and how long it was idle until the
+// last solver finished.  Time spent stealing counts as idle
+static void
+print_solver_metrics()
+{
+	uint64_t end_ns = 0;
+
+	for (int i = 0; i < ctx->nthreads; i++)
+		if (ctx->deques[i].end_ns > end_ns)
+			end_ns = ctx->deques[i].end_ns;
+
+	printf("\nSolver    Busy (ms)   Idle (ms)   Steals\n");
+	for (int i = 0; i < ctx->nthreads; i++) {
+		struct deque *dq = ctx->deques + i;
+
+		printf("%6d %12.3f %11.3f %8u\n", i, dq->busy_ns / 1e6,
+			(end_ns - dq->start_ns - dq->busy_ns) / 1e6, dq->steals);
+	}
+} // print_solver_metrics
+
+#ifdef SEARCH_STATS
+static const char *
+finder_name(int skips)
+{
+	static char name[NUM_SKIPS + 1][16];
+
+	if (skips == NUM_SKIPS)
+		return "find_solutions";
+	if (skips == 0)
+		return "find_skipped";
+	snprintf(name[skips], sizeof(name[skips]), "find_skipped_%d", skips);
+	return name[skips];
+} // finder_name
+
+// The finder calls and tier range scans at each depth, which is how many
+// words had been placed, summed over the solvers.  Then how often each
+// frequency set was scanned at each depth, in set order
+static void
+print_search_stats()
+{
+	struct search_stats sum[1];
+	uint64_t *in, *out = (uint64_t *)sum;
+
+	memset(sum, 0, sizeof(sum));
+	for (int i = 0; i < ctx->nthreads; i++) {
+		in = (uint64_t *)&ctx->deques[i].stats;
+		for (size_t n = 0; n < (sizeof(*sum) / sizeof(*out)); n++)
+			out[n] += in[n];
+	}
+
+	printf("\nSEARCH STATS :\n\nDepth");
+	for (int s = NUM_SKIPS; s >= 0; s--)
+		printf(" %16s", finder_name(s));
+	printf("      Scans    Scanned    Matched  Match%%  Empty%%\n");
+
+	for (int d = 0; d <= NUM_WORDS; d++) {
+		printf("%5d", d);
+		for (int s = NUM_SKIPS; s >= 0; s--)
+			printf(" %16lu", sum->calls[s][d]);
+		if ((d < NUM_WORDS) && sum->scans[d])
+			printf(" %10lu %10lu %10lu %6.2f%% %6.2f%%", sum->scans[d], sum->scanned[d],
+				sum->matched[d], (100.0 * sum->matched[d]) / (sum->scanned[d] ? sum->scanned[d] : 1),
+				(100.0 * sum->empty[d]) / sum->scans[d]);
+		printf("\n");
+	}
+
+	printf("\nSet  Scans by Depth\n");
+	for (int i = 0; i < 26; i++) {
+		struct frequency *f = ctx->frq + i;
+
+		printf("  %c ", 'a' + f->b);
+		for (int d = 0; d < NUM_WORDS; d++)
+			printf(" %10lu", sum->set_scans[f->b][d]);
+		printf("\n");
+	}
+} // print_search_stats
+#endif
+
 int
 main(int argc, char *argv[])
 {
 	struct timespec t1[1], t2[1], t3[1], t4[1], t5[1];
-	char file[256];
+	char file[256], *cache_file = NULL;
 	pthread_t tid[1];
 
 	// Copy in the default file-name
 	strcpy(file, "words_alpha.txt");
 
-	nthreads = get_nthreads();
+	settings_init();
+	ctx->nthreads = get_nthreads();
 
 	if (argc > 1) {
 		for (int i = 1; i < argc; i++) {
@@ -978,37 +3231,156 @@ main(int argc, char *argv[])
 
 			if (!strncmp(argv[i], "-t", 2)) {
 				if ((i + 1) < argc) {
-					nthreads = atoi(argv[i+1]);
+					ctx->nthreads = atoi(argv[i+1]);
+					i++;
+					if (ctx->nthreads < 0)
+						ctx->nthreads = 1;
+					if (ctx->nthreads > MAX_THREADS)
+						ctx->nthreads = MAX_THREADS;
+					continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-p", 2)) {
+				ctx->use_mph = 1;
+				continue;
+			}
+
+			if (!strncmp(argv[i], "-a", 2)) {
+				pin_threads = 1;
+				continue;
+			}
+
+			if (!strncmp(argv[i], "-s", 2)) {
+				if ((i + 1) < argc) {
+					ctx->spin_budget = atoi(argv[++i]);
+					if (ctx->spin_budget >= 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-d", 2)) {
+				if ((i + 1) < argc) {
+					ctx->tier_bits = atoi(argv[++i]);
+					if ((ctx->tier_bits >= 2) && (ctx->tier_bits <= TIER_BITS))
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-c", 2)) {
+				if ((i + 1) < argc) {
+					cache_file = argv[i+1];
 					i++;
-					if (nthreads < 0)
-						nthreads = 1;
-					if (nthreads > MAX_THREADS)
-						nthreads = MAX_THREADS;
 					continue;
 				}
 			}
 
-			printf("Usage: %s [-v] [-t num_threads] [-f filename]\n", argv[0]);
+			if (!strncmp(argv[i], "-r", 2)) {
+				if ((i + 1) < argc) {
+					ctx->reader_backend = parse_reader_backend(argv[i+1]);
+					i++;
+					if (ctx->reader_backend >= 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-n", 2)) {
+				if ((i + 1) < argc) {
+					ctx->force_nodes = atoi(argv[++i]);
+					if (ctx->force_nodes > 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-w", 2)) {
+				if ((i + 1) < argc) {
+					if (add_seed_word(argv[++i]) == 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-i", 2)) {
+				if ((i + 1) < argc) {
+					if (add_letters(&ctx->required, argv[++i]) == 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-x", 2)) {
+				if ((i + 1) < argc) {
+					if (add_letters(&ctx->excluded, argv[++i]) == 0)
+						continue;
+				}
+			}
+
+			if (!strncmp(argv[i], "-e", 2)) {
+				if ((i + 1) < argc) {
+					ctx->solver_engine = parse_solver_engine(argv[i+1]);
+					i++;
+					if (ctx->solver_engine >= 0)
+						continue;
+				}
+			}
+
+#ifdef RUNTIME_DISPATCH
+			if (!strncmp(argv[i], "-k", 2)) {
+				if ((i + 1) < argc) {
+					kernel_isa = parse_kernel_isa(argv[i+1]);
+					i++;
+					if (kernel_isa >= 0)
+						continue;
+				}
+			}
+
+			printf("Usage: %s [-v] [-p] [-a] [-s spins] [-d tier_bits] [-t num_threads] [-f filename] [-c cachefile] "
+				"[-r mmap|pread|uring|stream] [-e dfs|bfs|bitmap|mitm] [-k scalar|avx2|avx512] "
+				"[-n num_nodes] [-w word] [-i letters] [-x letters]\n", argv[0]);
+#else
+			printf("Usage: %s [-v] [-p] [-a] [-s spins] [-d tier_bits] [-t num_threads] [-f filename] [-c cachefile] "
+				"[-r mmap|pread|uring|stream] [-e dfs|bfs|bitmap|mitm] [-n num_nodes] [-w word] [-i letters] [-x letters]\n", argv[0]);
+#endif
 			exit(1);
 		}
 	}
 
-	if (nthreads <= 0)
-		nthreads = 1;
-	if (nthreads > MAX_THREADS)
-		nthreads = MAX_THREADS;
+	if (ctx->nthreads <= 0)
+		ctx->nthreads = 1;
+	if (ctx->nthreads > MAX_THREADS)
+		ctx->nthreads = MAX_THREADS;
 
-	for (int i = 1; i < nthreads; i++)
-		pthread_create(tid, NULL, work_pool, workers + i);
+#ifdef RUNTIME_DISPATCH
+	select_kernels();
+#endif
+	numa_init();
+
+	if (pin_threads) {
+		affinity_init();
+		pin_thread(0);
+	}
+
+	for (int i = 1; i < ctx->nthreads; i++)
+		pthread_create(tid, NULL, work_pool, ctx->workers + i);
 
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t1);
 
-	read_words(file);
+	if ((!cache_file || !load_word_cache(cache_file, file)) && (read_words(file) < 0))
+		exit(EXIT_FAILURE);
 
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t2);
 
+	if (ctx->use_mph)
+		mph_layout();
+
 	setup_frequency_sets();
 
+	if (setup_constraints() < 0) {
+		fprintf(stderr, "A -w word is not in %s\n", file);
+		exit(EXIT_FAILURE);
+	}
+
+	if (ctx->use_mph)
+		mph_build();
+
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t3);
 
 	solve();
@@ -1019,23 +3391,65 @@ main(int argc, char *argv[])
 
 	if (write_metrics) clock_gettime(CLOCK_MONOTONIC, t5);
 
+	// Saving the cache is not part of the timed run
+	if (cache_file && !ctx->cache_hit)
+		save_word_cache(cache_file, file);
+
 	if (!write_metrics)
 		exit(0);
 
 	printf("\nFrequency Table:\n");
 	for (int i = 0; i < 26; i++) {
-		struct tier *t = frq[i].sets;
-		char c = 'a' + __builtin_ctz(frq[i].m);
-		printf("%c set_length=%4d  toff1=%4d, toff2=%4d, toff[3]=%4d\n",
-			c, t->l, t->toff1, t->toff2, t->toff3);
+		struct frequency *f = ctx->frq + i;
+		struct tier *t = f->sets;
+		char c = 'a' + __builtin_ctz(f->m), tl[TIER_BITS + 3] = "", *tp = tl;
+
+		// The first set has no tiers.  The splitting letters come first,
+		// and then the two window letters
+		if (i > 0) {
+			for (int n = 0; n < ctx->tier_bits; n++)
+				*tp++ = 'a' + __builtin_ctz(f->tm[n]);
+			*tp++ = 'a' + __builtin_ctz(f->tw1);
+			*tp++ = 'a' + __builtin_ctz(f->tw2);
+		}
+		printf("%c set_length=%4d  toff1=%4d, toff2=%4d, toff[3]=%4d  tiers=%s\n",
+			c, t->l, t->toff1, t->toff2, t->toff3, tl);
 	}
 	printf("\n\n");
 
-	printf("Num Unique Words  = %8d\n", nkeys);
-	printf("Hash Collisions   = %8u\n", hash_collisions);
-	printf("Number of threads = %8d\n", nthreads);
+	printf("Num Unique Words  = %8d\n", ctx->nkeys);
+	printf("Hash Collisions   = %8u\n", ctx->hash_collisions);
+	printf("Number of threads = %8d\n", ctx->nthreads);
+	printf("NUMA Nodes        = %8d\n", ctx->num_nodes);
+	if (pin_threads && num_pin_cpus) {
+		printf("Pinned to CPUs    =");
+		for (int i = 0; i < ctx->nthreads; i++)
+			printf(" %d", cpu_order[i % num_pin_cpus]);
+		printf("\n");
+	}
+#ifdef RUNTIME_DISPATCH
+	printf("Solver kernels    = %8s\n", kernel_names[kernel_isa]);
+#endif
+	printf("Solver engine     = %8s\n", engine_names[ctx->solver_engine]);
+	if (ctx->solver_engine == ENGINE_BITMAP)
+		printf("Bitmap Build      = %8.3fms for %.1fMB\n", ctx->bitmap_ns / 1e6,
+			(ctx->bwords * 8.0) / (1 << 20));
+	if (ctx->solver_engine == ENGINE_MITM)
+		printf("Pair Partitions   = %8u for %.2fM pairs\n", ctx->mitm_passes,
+			ctx->moff[ctx->bbase[26]] / 1e6);
+	if (cache_file)
+		printf("Word Cache        = %8s\n", ctx->cache_hit ? "hit" : "miss");
+	if (ctx->use_mph)
+		printf("Perfect Hash      = %8.2f bits/key\n",
+			((double)ctx->mph_buckets * 16) / ctx->nkeys);
+	print_tier_metrics();
+	print_reader_metrics();
+	print_solver_metrics();
+#ifdef SEARCH_STATS
+	print_search_stats();
+#endif
 
-	printf("\nNUM SOLUTIONS = %d\n", num_sol);
+	printf("\nNUM SOLUTIONS = %d\n", ctx->num_sol);
 
 	printf("\nTIMES TAKEN :\n");
 	print_time_taken("Total", t1, t5);